@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Compares hpx::kokkos::reduce_by_key and hpx::kokkos::inclusive_scan_by_key
+/// with the generic HPX algorithms on the host. The data is in host memory so
+/// that both versions can access it. HPX has no segmented scan, so the
+/// segmented scan is compared to the unsegmented hpx::inclusive_scan.
+
+#include <Kokkos_Core.hpp>
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+#include <hpx/numeric.hpp>
+
+#include <functional>
+#include <iostream>
+#include <string>
+
+using elem_type = double;
+using key_type = int;
+using execution_space = Kokkos::DefaultHostExecutionSpace;
+using value_view_type = Kokkos::View<elem_type *, execution_space>;
+using key_view_type = Kokkos::View<key_type *, execution_space>;
+
+void print_header() {
+  std::cout << "test_name,execution_space,subtest_name,vector_size,"
+               "segment_size,time"
+            << std::endl;
+}
+
+template <typename F>
+void time_test(std::string const &label, F const &f, int size,
+               int segment_size) {
+  hpx::chrono::high_resolution_timer timer;
+  f();
+  double const elapsed = timer.elapsed();
+
+  std::cout << "by_key," << execution_space().name() << "," << label << ","
+            << size << "," << segment_size << "," << elapsed << std::endl;
+}
+
+void test_by_key(int repetitions, int size, int segment_size) {
+  key_view_type keys("keys", size);
+  key_view_type keys_out("keys_out", size);
+  value_view_type values("values", size);
+  value_view_type values_out("values_out", size);
+  for (int i = 0; i < size; ++i) {
+    keys(i) = i / segment_size;
+  }
+  Kokkos::deep_copy(values, 1.0);
+
+  hpx::kokkos::executor<execution_space> exec;
+
+  for (int i = 0; i < repetitions; ++i) {
+    time_test(
+        "reduce_by_key_kokkos",
+        [&] {
+          hpx::kokkos::reduce_by_key(
+              hpx::kokkos::kok.on(exec).label("reduce_by_key"), keys.data(),
+              keys.data() + size, values.data(), keys_out.data(),
+              values_out.data());
+        },
+        size, segment_size);
+    time_test(
+        "reduce_by_key_hpx",
+        [&] {
+          hpx::experimental::reduce_by_key(
+              hpx::execution::par, keys.data(), keys.data() + size,
+              values.data(), keys_out.data(), values_out.data(),
+              std::equal_to<key_type>(), std::plus<elem_type>());
+        },
+        size, segment_size);
+    time_test(
+        "inclusive_scan_by_key_kokkos",
+        [&] {
+          hpx::kokkos::inclusive_scan_by_key(
+              hpx::kokkos::kok.on(exec).label("inclusive_scan_by_key"),
+              keys.data(), keys.data() + size, values.data(),
+              values_out.data());
+        },
+        size, segment_size);
+    time_test(
+        "inclusive_scan_hpx",
+        [&] {
+          hpx::inclusive_scan(hpx::execution::par, values.data(),
+                              values.data() + size, values_out.data());
+        },
+        size, segment_size);
+  }
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+
+    print_header();
+    for (int size = 1024; size <= (1024 << 11); size *= 2) {
+      for (int segment_size : {4, 64, 1024}) {
+        test_by_key(10, size, segment_size);
+      }
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,93 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Measures the bandwidth of host-to-host copies with
+/// hpx::kokkos::deep_copy_async, Kokkos::deep_copy, and std::memcpy. The
+/// bandwidth counts both the loads and the stores of the copy.
+
+#include <Kokkos_Core.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using elem_type = double;
+using execution_space = Kokkos::DefaultHostExecutionSpace;
+using view_type = Kokkos::View<elem_type *, execution_space>;
+
+void print_header() {
+  std::cout << "test_name,execution_space,subtest_name,vector_size,"
+               "element_size,time,bandwidth_gb_s"
+            << std::endl;
+}
+
+template <typename F>
+void time_test(std::string const &label, F const &f, std::size_t size) {
+  hpx::chrono::high_resolution_timer timer;
+  f();
+  double const elapsed = timer.elapsed();
+  double const bandwidth = 2.0 * size * sizeof(elem_type) / elapsed / 1e9;
+
+  std::cout << "copy," << execution_space().name() << "," << label << ","
+            << size << "," << sizeof(elem_type) << "," << elapsed << ","
+            << bandwidth << std::endl;
+}
+
+void test_copy(int repetitions, std::size_t size) {
+  execution_space inst;
+  // The views are first touched in parallel on the execution space.
+  view_type src("src", size);
+  view_type dst("dst", size);
+  Kokkos::deep_copy(inst, src, 1.0);
+  inst.fence();
+
+  for (int i = 0; i < repetitions; ++i) {
+    time_test(
+        "hpx_kokkos_deep_copy_async",
+        [&] { hpx::kokkos::deep_copy_async(inst, dst, src).get(); }, size);
+    time_test(
+        "kokkos_deep_copy",
+        [&] {
+          Kokkos::deep_copy(inst, dst, src);
+          inst.fence();
+        },
+        size);
+    time_test(
+        "memcpy",
+        [&] {
+          std::memcpy(dst.data(), src.data(), size * sizeof(elem_type));
+        },
+        size);
+  }
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+
+    print_header();
+    for (std::size_t size = 1024; size <= (std::size_t(1024) << 15);
+         size *= 2) {
+      test_copy(10, size);
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Compares a monolithic deep_copy_async followed by a consumer kernel with
+/// deep_copy_chunked_async, where the consumer kernel of each chunk is
+/// launched on a second instance as soon as the chunk has been copied. The
+/// copy is host-to-host so that it can be run on the HPX backend.
+
+#include <Kokkos_Core.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using elem_type = double;
+using execution_space = Kokkos::DefaultHostExecutionSpace;
+using view_type = Kokkos::View<elem_type *, execution_space>;
+
+void print_header() {
+  std::cout << "test_name,execution_space,subtest_name,vector_size,"
+               "num_chunks,time"
+            << std::endl;
+}
+
+template <typename F>
+void time_test(std::string const &label, F const &f, int size,
+               int num_chunks) {
+  hpx::chrono::high_resolution_timer timer;
+  f();
+  double const elapsed = timer.elapsed();
+
+  std::cout << "deep_copy_chunked," << execution_space().name() << ","
+            << label << "," << size << "," << num_chunks << "," << elapsed
+            << std::endl;
+}
+
+hpx::shared_future<void> consume(execution_space const &instance,
+                                 view_type const &v, std::size_t const b,
+                                 std::size_t const e) {
+  return hpx::kokkos::parallel_for_async(
+      "consume", Kokkos::RangePolicy<execution_space>(instance, b, e),
+      KOKKOS_LAMBDA(int i) { v(i) = 2.0 * v(i) + 1.0; });
+}
+
+void test_deep_copy_chunked(int repetitions, int size, int num_chunks) {
+  view_type src("src", size);
+  view_type dst("dst", size);
+  Kokkos::deep_copy(src, 1.0);
+
+  auto const copy_instance =
+      hpx::kokkos::executor<execution_space>(
+          hpx::kokkos::execution_space_mode::independent)
+          .instance();
+  auto const compute_instance =
+      hpx::kokkos::executor<execution_space>(
+          hpx::kokkos::execution_space_mode::independent)
+          .instance();
+
+  for (int i = 0; i < repetitions; ++i) {
+    time_test(
+        "monolithic",
+        [&] {
+          // The future returned by the continuation is unwrapped.
+          hpx::kokkos::deep_copy_async(copy_instance, dst, src)
+              .then([&](hpx::shared_future<void> &&) {
+                return consume(compute_instance, dst, 0, size);
+              })
+              .get();
+        },
+        size, 1);
+    time_test(
+        "chunked",
+        [&] {
+          auto copied = hpx::kokkos::deep_copy_chunked_async(
+              copy_instance, dst, src, num_chunks);
+          std::vector<hpx::shared_future<void>> consumed;
+          consumed.reserve(copied.size());
+          for (std::size_t c = 0; c < copied.size(); ++c) {
+            auto const bounds =
+                hpx::kokkos::get_chunk_bounds(size, copied.size(), c);
+            consumed.push_back(
+                copied[c].then([&, bounds](hpx::shared_future<void> &&) {
+                  return consume(compute_instance, dst, bounds.first,
+                                 bounds.second);
+                }));
+          }
+          hpx::wait_all(consumed);
+        },
+        size, num_chunks);
+  }
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+
+    print_header();
+    for (int size = 1024 << 6; size <= (1024 << 14); size *= 4) {
+      for (int num_chunks : {2, 4, 8, 16}) {
+        test_deep_copy_chunked(10, size, num_chunks);
+      }
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
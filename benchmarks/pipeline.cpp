@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Compares a chain of separate asynchronous algorithm launches (scale, add,
+/// sum) with the same computation expressed as a fused pipeline of two
+/// transforms and a reduction. Array sizes are the same as in the stream
+/// benchmark. The reported bandwidth is computed from the bytes each version
+/// moves: the unfused version reads and writes a temporary array between
+/// launches, the fused version reads each input only once.
+
+#include <Kokkos_Core.hpp>
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+#include <hpx/numeric.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+using elem_type = double;
+using view_type = Kokkos::View<elem_type *>;
+
+void print_header() {
+  std::cout << "test_name,execution_space,subtest_name,vector_size,"
+               "element_size,bytes_moved,time,bandwidth_gbs"
+            << std::endl;
+}
+
+template <typename F>
+void time_test(std::string const &label, F const &f, view_type a, view_type b,
+               view_type tmp, std::size_t bytes_moved) {
+  hpx::chrono::high_resolution_timer timer;
+  elem_type const result = f(a, b, tmp);
+  double const elapsed = timer.elapsed();
+
+  elem_type const expected = elem_type(5.0) * a.extent(0);
+  if (std::abs(result - expected) > 1e-6 * expected) {
+    std::cerr << "Unexpected result " << result << ", expected " << expected
+              << std::endl;
+    throw std::runtime_error("Solution does not validate");
+  }
+
+  std::cout << "pipeline," << Kokkos::DefaultExecutionSpace().name() << ","
+            << label << "," << a.extent(0) << "," << sizeof(elem_type) << ","
+            << bytes_moved << "," << elapsed << ","
+            << bytes_moved / elapsed / 1e9 << std::endl;
+}
+
+// Two transforms and a reduction as three separate asynchronous launches on
+// the same instance, each streaming memory once.
+elem_type test_unfused(view_type a, view_type b, view_type tmp) {
+  elem_type const scalar = 3.0;
+  hpx::kokkos::default_executor exec;
+  auto policy = hpx::kokkos::kok(hpx::execution::task).on(exec);
+  hpx::experimental::for_loop(
+      policy.label("scale"), 0, a.extent(0),
+      KOKKOS_LAMBDA(int i) { tmp(i) = scalar * a(i); });
+  hpx::experimental::for_loop(
+      policy.label("add"), 0, a.extent(0),
+      KOKKOS_LAMBDA(int i) { tmp(i) += b(i); });
+  return hpx::ranges::reduce(policy.label("sum"), tmp, elem_type(0),
+                             KOKKOS_LAMBDA(elem_type x, elem_type y) {
+                               return x + y;
+                             })
+      .get();
+}
+
+// The same two transforms and reduction fused into a single kernel.
+elem_type test_fused(view_type a, view_type b, view_type) {
+  elem_type const scalar = 3.0;
+  return hpx::kokkos::pipeline(hpx::kokkos::kok.label("fused"),
+                               Kokkos::RangePolicy<>(0, a.extent(0)))
+      .transform(KOKKOS_LAMBDA(int i) {
+        return Kokkos::pair<int, elem_type>(i, scalar * a(i));
+      })
+      .transform(KOKKOS_LAMBDA(Kokkos::pair<int, elem_type> const &p) {
+        return p.second + b(p.first);
+      })
+      .reduce(elem_type(0),
+              KOKKOS_LAMBDA(elem_type x, elem_type y) { return x + y; });
+}
+
+void test_pipeline(int repetitions, int size) {
+  view_type a("a", size);
+  view_type b("b", size);
+  view_type tmp("tmp", size);
+  Kokkos::deep_copy(a, 1.0);
+  Kokkos::deep_copy(b, 2.0);
+
+  std::size_t const unfused_bytes = 6 * size * sizeof(elem_type);
+  std::size_t const fused_bytes = 2 * size * sizeof(elem_type);
+
+  for (int i = 0; i < repetitions; ++i) {
+    time_test("unfused", &test_unfused, a, b, tmp, unfused_bytes);
+    time_test("fused", &test_fused, a, b, tmp, fused_bytes);
+  }
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+
+    print_header();
+    for (int size = 1024; size <= (1024 << 11); size *= 2) {
+      test_pipeline(10, size);
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,101 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Compares the allocation and deallocation of Kokkos::Views with pooled
+/// asynchronous allocation through hpx::kokkos::make_view_async. Each
+/// repetition allocates a view, launches a kernel writing to it, and drops
+/// the view.
+
+#include <Kokkos_Core.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <iostream>
+#include <string>
+
+using elem_type = double;
+
+void print_header() {
+  std::cout << "test_name,execution_space,subtest_name,vector_size,"
+               "repetitions,time,time_per_allocation"
+            << std::endl;
+}
+
+template <typename ExecutionSpace> void test_kokkos(int repetitions, int size) {
+  ExecutionSpace instance;
+  for (int r = 0; r < repetitions; ++r) {
+    Kokkos::View<elem_type *, typename ExecutionSpace::memory_space> v(
+        "kokkos_view", size);
+    Kokkos::parallel_for(
+        "kokkos_view write",
+        Kokkos::RangePolicy<ExecutionSpace>(instance, 0, size),
+        KOKKOS_LAMBDA(int i) { v(i) = i; });
+  }
+  instance.fence();
+}
+
+template <typename ExecutionSpace> void test_pooled(int repetitions, int size) {
+  ExecutionSpace instance;
+  for (int r = 0; r < repetitions; ++r) {
+    auto pv = hpx::kokkos::make_view_async<elem_type *>(instance, "pooled_view",
+                                                        size)
+                  .get();
+    auto v = pv.view();
+    Kokkos::parallel_for(
+        "pooled_view write",
+        Kokkos::RangePolicy<ExecutionSpace>(instance, 0, size),
+        KOKKOS_LAMBDA(int i) { v(i) = i; });
+  }
+  instance.fence();
+}
+
+template <typename ExecutionSpace, typename F>
+void time_test(std::string const &label, F const &f, int repetitions,
+               int size) {
+  hpx::chrono::high_resolution_timer timer;
+  f(repetitions, size);
+  double const elapsed = timer.elapsed();
+
+  std::cout << "view_pool," << ExecutionSpace().name() << "," << label << ","
+            << size << "," << repetitions << "," << elapsed << ","
+            << elapsed / repetitions << std::endl;
+}
+
+template <typename ExecutionSpace> void test_view_pool(int size) {
+  int const repetitions = 100;
+  time_test<ExecutionSpace>("kokkos", &test_kokkos<ExecutionSpace>,
+                            repetitions, size);
+  time_test<ExecutionSpace>("pooled", &test_pooled<ExecutionSpace>,
+                            repetitions, size);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+
+    print_header();
+    for (int size = 1024; size <= (1024 << 11); size *= 2) {
+      test_view_pool<Kokkos::DefaultExecutionSpace>(size);
+      if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                        Kokkos::DefaultHostExecutionSpace>::value) {
+        test_view_pool<Kokkos::DefaultHostExecutionSpace>(size);
+      }
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -10,15 +10,26 @@
 
 #pragma once
 
+#include <hpx/kokkos/adaptive_polling.hpp>
+#include <hpx/kokkos/co_executor.hpp>
 #include <hpx/kokkos/config.hpp>
 #include <hpx/kokkos/deep_copy.hpp>
 #include <hpx/kokkos/detail/version.hpp>
 #include <hpx/kokkos/execution_spaces.hpp>
 #include <hpx/kokkos/executors.hpp>
 #include <hpx/kokkos/future.hpp>
+#include <hpx/kokkos/histogram.hpp>
 #include <hpx/kokkos/hpx_algorithms.hpp>
 #include <hpx/kokkos/import.hpp>
 #include <hpx/kokkos/instance_helper.hpp>
 #include <hpx/kokkos/kokkos_algorithms.hpp>
+#include <hpx/kokkos/mirror_view.hpp>
+#include <hpx/kokkos/performance_counters.hpp>
+#include <hpx/kokkos/pipeline.hpp>
 #include <hpx/kokkos/policy.hpp>
+#include <hpx/kokkos/scratch_arena.hpp>
+#include <hpx/kokkos/stream_pipeline.hpp>
+#include <hpx/kokkos/trace.hpp>
 #include <hpx/kokkos/view.hpp>
+#include <hpx/kokkos/view_io.hpp>
+#include <hpx/kokkos/view_pool.hpp>
@@ -0,0 +1,418 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains adaptive polling of event sources. Events are only polled while
+/// some are outstanding, and polling backs off exponentially while polls
+/// complete nothing. Device backends use it for futures when
+/// HPX_KOKKOS_CUDA_FUTURE_TYPE is 2 (adaptive).
+
+#pragma once
+
+#include <hpx/kokkos/detail/logging.hpp>
+
+#include <hpx/future.hpp>
+#include <hpx/thread.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+namespace kokkos {
+/// Parameters of an adaptive_poller. Intervals are counted in calls to
+/// adaptive_poller::poll, i.e. scheduler iterations of the polling thread.
+struct adaptive_polling_parameters {
+  /// Interval between polls right after a poll completed events.
+  std::size_t min_interval = 1;
+  /// Upper bound for the interval when polls complete nothing.
+  std::size_t max_interval = 64;
+  /// Poll from an HPX thread while events are outstanding. If false, poll
+  /// must be called explicitly.
+  bool use_polling_thread = true;
+  /// Time for which the polling thread suspends per iteration skipped by
+  /// backoff, instead of yielding in each of them.
+  std::chrono::microseconds backoff_sleep{10};
+};
+
+/// Counters of an adaptive_poller.
+struct adaptive_polling_statistics {
+  /// Number of iterations, i.e. calls to adaptive_poller::poll and
+  /// iterations skipped by the polling thread while suspended.
+  std::size_t num_iterations = 0;
+  /// Number of iterations skipped because no events were outstanding.
+  std::size_t num_idle_iterations = 0;
+  /// Number of iterations skipped because of backoff.
+  std::size_t num_backoff_iterations = 0;
+  /// Number of times the event source was polled.
+  std::size_t num_polls = 0;
+  /// Number of polls that completed no events.
+  std::size_t num_empty_polls = 0;
+  /// Number of completed events.
+  std::size_t num_completions = 0;
+
+  /// Fraction of iterations in which the event source was polled.
+  double poll_fraction() const {
+    return num_iterations > 0 ? double(num_polls) / num_iterations : 0.0;
+  }
+};
+
+namespace detail {
+template <typename EventSource> class adaptive_poller_state {
+public:
+  adaptive_poller_state(EventSource &&source,
+                        adaptive_polling_parameters const &parameters)
+      : source(std::move(source)), parameters(parameters),
+        interval((std::max)(std::size_t(1), parameters.min_interval)) {
+    if (parameters.max_interval < interval) {
+      throw std::invalid_argument(
+          "hpx::kokkos::adaptive_poller: max_interval must be at least "
+          "min_interval");
+    }
+  }
+
+  std::size_t poll() {
+    // Only one thread polls at a time. Other threads return immediately.
+    if (polling.exchange(true)) {
+      return 0;
+    }
+    struct reset_polling {
+      std::atomic<bool> &polling;
+      ~reset_polling() { polling.store(false); }
+    } reset{polling};
+
+    {
+      std::lock_guard<std::mutex> l(mtx);
+      ++stats.num_iterations;
+      if (outstanding.load() == 0) {
+        ++stats.num_idle_iterations;
+        return 0;
+      }
+      if (countdown > 0) {
+        --countdown;
+        ++stats.num_backoff_iterations;
+        return 0;
+      }
+      ++stats.num_polls;
+    }
+
+    // The source may run continuations of completed events, so no lock is
+    // held while polling.
+    std::size_t const completed = source.poll();
+    remove_outstanding(completed);
+
+    std::lock_guard<std::mutex> l(mtx);
+    if (completed == 0) {
+      ++stats.num_empty_polls;
+      interval = (std::min)(interval * 2, parameters.max_interval);
+    } else {
+      stats.num_completions += completed;
+      interval = (std::max)(std::size_t(1), parameters.min_interval);
+    }
+    countdown = interval - 1;
+
+    return completed;
+  }
+
+  void remove_outstanding(std::size_t const n) {
+    std::size_t current = outstanding.load();
+    while (!outstanding.compare_exchange_weak(
+        current, current - (std::min)(current, n))) {
+    }
+  }
+
+  // Skips the iterations remaining until the next poll and returns their
+  // number.
+  std::size_t skip_backoff() {
+    std::lock_guard<std::mutex> l(mtx);
+    std::size_t const skipped = countdown;
+    countdown = 0;
+    stats.num_iterations += skipped;
+    stats.num_backoff_iterations += skipped;
+    return skipped;
+  }
+
+  // Starts a polling thread unless one is already running.
+  static void ensure_polling_thread(
+      std::shared_ptr<adaptive_poller_state> const &state) {
+    if (state->parameters.use_polling_thread &&
+        !state->polling_thread_running.exchange(true)) {
+      hpx::async([state]() { run_polling_thread(state); });
+    }
+  }
+
+  // Polls until no events are outstanding. While backing off the thread
+  // suspends for the skipped iterations, so that it does not keep a worker
+  // thread busy. Otherwise it yields between iterations so that other HPX
+  // threads can run.
+  static void
+  run_polling_thread(std::shared_ptr<adaptive_poller_state> const &state) {
+    HPX_KOKKOS_DETAIL_LOG("starting adaptive polling thread");
+    while (true) {
+      while (state->outstanding.load() > 0 && !state->stopped.load()) {
+        state->poll();
+        std::size_t const skipped = state->skip_backoff();
+        if (skipped > 0) {
+          hpx::this_thread::sleep_for(state->parameters.backoff_sleep *
+                                      skipped);
+        } else {
+          hpx::this_thread::yield();
+        }
+      }
+
+      state->polling_thread_running.store(false);
+      // Events may have been added after the last check, in which case this
+      // thread continues unless another one has been started.
+      if (state->outstanding.load() == 0 || state->stopped.load() ||
+          state->polling_thread_running.exchange(true)) {
+        break;
+      }
+    }
+    HPX_KOKKOS_DETAIL_LOG("stopping adaptive polling thread");
+  }
+
+  EventSource source;
+  adaptive_polling_parameters const parameters;
+  std::atomic<std::size_t> outstanding{0};
+  std::atomic<bool> polling_thread_running{false};
+  std::atomic<bool> stopped{false};
+  std::atomic<bool> polling{false};
+
+  mutable std::mutex mtx;
+  std::size_t interval;
+  std::size_t countdown = 0;
+  adaptive_polling_statistics stats;
+};
+} // namespace detail
+
+/// \brief Polls an EventSource adaptively. EventSource must provide a
+/// std::size_t poll() member function that completes ready events and returns
+/// how many it completed. Users of the poller register events with
+/// add_outstanding before they can complete.
+///
+/// The source is only polled while events are outstanding. Each poll that
+/// completes nothing doubles the interval between polls up to max_interval,
+/// and a poll that completes events resets it to min_interval. Unless
+/// disabled in the parameters, an HPX thread calls poll while events are
+/// outstanding and exits when all have completed. The thread suspends for
+/// backoff_sleep per iteration skipped by backoff.
+template <typename EventSource> class adaptive_poller {
+public:
+  explicit adaptive_poller(EventSource source = EventSource(),
+                           adaptive_polling_parameters const &parameters =
+                               adaptive_polling_parameters())
+      : state(std::make_shared<detail::adaptive_poller_state<EventSource>>(
+            std::move(source), parameters)) {}
+
+  ~adaptive_poller() {
+    if (state) {
+      state->stopped.store(true);
+    }
+  }
+
+  adaptive_poller(adaptive_poller &&) = default;
+  adaptive_poller &operator=(adaptive_poller &&) = default;
+
+  /// Registers n outstanding events and starts polling if needed.
+  void add_outstanding(std::size_t const n = 1) {
+    state->outstanding.fetch_add(n);
+    detail::adaptive_poller_state<EventSource>::ensure_polling_thread(state);
+  }
+
+  /// Unregisters n outstanding events that will not be completed by the
+  /// event source, e.g. because they could not be recorded.
+  void remove_outstanding(std::size_t const n = 1) {
+    state->remove_outstanding(n);
+  }
+
+  std::size_t outstanding() const { return state->outstanding.load(); }
+
+  /// Performs one polling iteration. Polls the event source if events are
+  /// outstanding and the current backoff interval has elapsed. Returns the
+  /// number of events completed by this call.
+  std::size_t poll() { return state->poll(); }
+
+  /// Returns the current number of iterations between polls.
+  std::size_t interval() const {
+    std::lock_guard<std::mutex> l(state->mtx);
+    return state->interval;
+  }
+
+  adaptive_polling_statistics statistics() const {
+    std::lock_guard<std::mutex> l(state->mtx);
+    return state->stats;
+  }
+
+  EventSource &source() { return state->source; }
+
+private:
+  std::shared_ptr<detail::adaptive_poller_state<EventSource>> state;
+};
+
+namespace detail {
+#if defined(KOKKOS_ENABLE_CUDA)
+struct cuda_event_api {
+  using event_type = cudaEvent_t;
+  using stream_type = cudaStream_t;
+  using error_type = cudaError_t;
+  static constexpr error_type success = cudaSuccess;
+  static constexpr error_type not_ready = cudaErrorNotReady;
+
+  static error_type create(event_type *e) {
+    return cudaEventCreateWithFlags(e, cudaEventDisableTiming);
+  }
+  static error_type record(event_type e, stream_type s) {
+    return cudaEventRecord(e, s);
+  }
+  static error_type query(event_type e) { return cudaEventQuery(e); }
+  static void destroy(event_type e) { cudaEventDestroy(e); }
+  static char const *error_string(error_type err) {
+    return cudaGetErrorString(err);
+  }
+};
+#endif
+
+#if defined(KOKKOS_ENABLE_HIP)
+struct hip_event_api {
+  using event_type = hipEvent_t;
+  using stream_type = hipStream_t;
+  using error_type = hipError_t;
+  static constexpr error_type success = hipSuccess;
+  static constexpr error_type not_ready = hipErrorNotReady;
+
+  static error_type create(event_type *e) {
+    return hipEventCreateWithFlags(e, hipEventDisableTiming);
+  }
+  static error_type record(event_type e, stream_type s) {
+    return hipEventRecord(e, s);
+  }
+  static error_type query(event_type e) { return hipEventQuery(e); }
+  static void destroy(event_type e) { hipEventDestroy(e); }
+  static char const *error_string(error_type err) {
+    return hipGetErrorString(err);
+  }
+};
+#endif
+
+// An event source completing futures for events recorded on device streams.
+// Api provides the event functions of the device runtime (see
+// cuda_event_api).
+template <typename Api> class device_event_source {
+public:
+  device_event_source() = default;
+  device_event_source(device_event_source &&other) noexcept
+      : pending(std::move(other.pending)) {}
+
+  hpx::shared_future<void> add(typename Api::stream_type stream) {
+    typename Api::event_type event;
+    auto err = Api::create(&event);
+    if (err == Api::success) {
+      err = Api::record(event, stream);
+      if (err != Api::success) {
+        Api::destroy(event);
+      }
+    }
+    if (err != Api::success) {
+      return hpx::make_exceptional_future<void>(std::runtime_error(
+          std::string("hpx::kokkos: could not record event: ") +
+          Api::error_string(err)));
+    }
+
+    hpx::promise<void> p;
+    hpx::shared_future<void> f = p.get_future();
+    std::lock_guard<std::mutex> l(mtx);
+    pending.emplace_back(event, std::move(p));
+    return f;
+  }
+
+  std::size_t poll() {
+    std::vector<std::pair<hpx::promise<void>, typename Api::error_type>>
+        completed;
+    {
+      std::lock_guard<std::mutex> l(mtx);
+      auto it = pending.begin();
+      while (it != pending.end()) {
+        auto const err = Api::query(it->first);
+        if (err == Api::not_ready) {
+          ++it;
+          continue;
+        }
+        Api::destroy(it->first);
+        completed.emplace_back(std::move(it->second), err);
+        it = pending.erase(it);
+      }
+    }
+
+    // Continuations may add events, so the promises are set without holding
+    // the lock.
+    for (auto &c : completed) {
+      if (c.second == Api::success) {
+        c.first.set_value();
+      } else {
+        c.first.set_exception(std::make_exception_ptr(std::runtime_error(
+            std::string("hpx::kokkos: event failed: ") +
+            Api::error_string(c.second))));
+      }
+    }
+
+    return completed.size();
+  }
+
+private:
+  std::mutex mtx;
+  std::vector<std::pair<typename Api::event_type, hpx::promise<void>>>
+      pending;
+};
+
+template <typename Api>
+adaptive_poller<device_event_source<Api>> &get_device_poller() {
+  static adaptive_poller<device_event_source<Api>> poller;
+  return poller;
+}
+
+// Returns a future that becomes ready when the work enqueued on stream so far
+// has completed, polled by the adaptive poller of the device.
+template <typename Api>
+hpx::shared_future<void>
+get_future_with_adaptive_polling(typename Api::stream_type stream) {
+  auto &poller = get_device_poller<Api>();
+  // The event is counted before it is added so that it is never completed
+  // while not counted as outstanding. Events that could not be recorded are
+  // returned as exceptional futures and are not outstanding.
+  poller.add_outstanding();
+  auto f = poller.source().add(stream);
+  if (f.has_exception()) {
+    poller.remove_outstanding();
+  }
+  return f;
+}
+} // namespace detail
+
+#if defined(KOKKOS_ENABLE_CUDA)
+/// Returns the statistics of the adaptive poller used for CUDA futures when
+/// HPX_KOKKOS_CUDA_FUTURE_TYPE is 2.
+inline adaptive_polling_statistics get_cuda_adaptive_polling_statistics() {
+  return detail::get_device_poller<detail::cuda_event_api>().statistics();
+}
+#endif
+
+#if defined(KOKKOS_ENABLE_HIP)
+/// Returns the statistics of the adaptive poller used for HIP futures when
+/// HPX_KOKKOS_CUDA_FUTURE_TYPE is 2.
+inline adaptive_polling_statistics get_hip_adaptive_polling_statistics() {
+  return detail::get_device_poller<detail::hip_event_api>().statistics();
+}
+#endif
+} // namespace kokkos
+} // namespace hpx
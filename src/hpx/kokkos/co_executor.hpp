@@ -0,0 +1,230 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains an HPX executor that splits work between a host and a device
+/// execution space, adapting the split to balance completion times.
+
+#pragma once
+
+#include <hpx/kokkos/config.hpp>
+#include <hpx/kokkos/executors.hpp>
+#include <hpx/kokkos/future.hpp>
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+namespace kokkos {
+namespace detail {
+// Shared state of a co_executor. Holds the fraction of the iteration space
+// that is given to the host execution space and updates it from the measured
+// completion times of both sides.
+class co_execution_state {
+public:
+  explicit co_execution_state(double const host_fraction)
+      : host_fraction(clamp(host_fraction)) {}
+
+  double get_host_fraction() const {
+    std::lock_guard<std::mutex> l(mtx);
+    return host_fraction;
+  }
+
+  // Moves the host fraction towards the fraction that would have made both
+  // sides finish at the same time, assuming constant throughput on each side.
+  void update(std::size_t const host_count, double const host_time,
+              std::size_t const device_count, double const device_time) {
+    if (host_count == 0 || device_count == 0 || host_time <= 0.0 ||
+        device_time <= 0.0) {
+      return;
+    }
+
+    double const host_rate = host_count / host_time;
+    double const device_rate = device_count / device_time;
+    double const balanced = host_rate / (host_rate + device_rate);
+
+    std::lock_guard<std::mutex> l(mtx);
+    host_fraction =
+        clamp((1.0 - smoothing) * host_fraction + smoothing * balanced);
+  }
+
+private:
+  static double clamp(double const f) {
+    return (std::min)((std::max)(f, min_fraction), 1.0 - min_fraction);
+  }
+
+  // Both sides always get some work so that the split can keep adapting.
+  static constexpr double min_fraction = 0.01;
+  static constexpr double smoothing = 0.5;
+
+  mutable std::mutex mtx;
+  double host_fraction;
+};
+} // namespace detail
+
+/// \brief The instances of a co_executor. Passed to the parallel algorithm
+/// specializations, which split the iteration space between the two
+/// instances.
+template <typename HostExecutionSpace, typename DeviceExecutionSpace>
+class co_instances {
+public:
+  using host_execution_space = HostExecutionSpace;
+  using device_execution_space = DeviceExecutionSpace;
+
+  co_instances(host_execution_space const &host,
+               device_execution_space const &device,
+               std::shared_ptr<detail::co_execution_state> state)
+      : host(host), device(device), state(std::move(state)) {}
+
+  host_execution_space const &host_instance() const { return host; }
+  device_execution_space const &device_instance() const { return device; }
+
+  /// Launches [0, n_host) with host_launch on the host instance and
+  /// [n_host, n) with device_launch on the device instance, where n_host is
+  /// determined by the current split ratio. The launch functions are called
+  /// with the bounds of their part and must return futures. The completion
+  /// times of both parts are used to update the split ratio. Returns the
+  /// futures of the host and device parts.
+  template <typename HostLaunch, typename DeviceLaunch>
+  auto co_execute(std::size_t const n, HostLaunch &&host_launch,
+                  DeviceLaunch &&device_launch) const {
+    std::size_t const n_host = static_cast<std::size_t>(
+        std::llround(n * state->get_host_fraction()));
+    std::size_t const n_device = n - n_host;
+
+    // The device part is launched first since the host part may block until
+    // completion for synchronous execution spaces. Both parts are timed from
+    // the same start, including their launches. The continuation of the
+    // device part is attached before launching the host part so that a
+    // blocking host launch is not counted as device time.
+    hpx::chrono::high_resolution_timer timer;
+    auto device_future = device_launch(n_host, n);
+    auto device_time = device_future.then(
+        hpx::launch::sync, [timer](auto &&) { return timer.elapsed(); });
+    auto host_future = host_launch(std::size_t(0), n_host);
+    auto host_time = host_future.then(
+        hpx::launch::sync, [timer](auto &&) { return timer.elapsed(); });
+    hpx::dataflow(
+        hpx::launch::sync,
+        [state = state, n_host, n_device](hpx::future<double> host_time,
+                                          hpx::future<double> device_time) {
+          state->update(n_host, host_time.get(), n_device, device_time.get());
+        },
+        std::move(host_time), std::move(device_time));
+
+    return std::make_pair(std::move(host_future), std::move(device_future));
+  }
+
+private:
+  host_execution_space host;
+  device_execution_space device;
+  std::shared_ptr<detail::co_execution_state> state;
+};
+
+/// \brief HPX executor splitting work between a host and a device execution
+/// space. The parallel algorithm specializations (for_each, for_loop, and
+/// reduce over one-dimensional ranges) split the iteration space between the
+/// two execution spaces and return a single combined future. The split ratio
+/// is adapted after each launch to balance the completion times of both
+/// sides. Copies of an executor share the split ratio. The data must be
+/// accessible from both execution spaces. Other executor functions use the
+/// device execution space only.
+template <typename HostExecutionSpace = Kokkos::DefaultHostExecutionSpace,
+          typename DeviceExecutionSpace = Kokkos::DefaultExecutionSpace>
+class co_executor {
+public:
+  using host_execution_space = HostExecutionSpace;
+  using device_execution_space = DeviceExecutionSpace;
+  using execution_space = DeviceExecutionSpace;
+  using execution_category = hpx::execution::parallel_execution_tag;
+
+  explicit co_executor(double const initial_host_fraction = 0.5)
+      : co_executor(host_execution_space{}, device_execution_space{},
+                    initial_host_fraction) {}
+
+  co_executor(host_execution_space const &host,
+              device_execution_space const &device,
+              double const initial_host_fraction = 0.5)
+      : host(host), device(device),
+        state(std::make_shared<detail::co_execution_state>(
+            initial_host_fraction)) {}
+
+  co_instances<host_execution_space, device_execution_space> instance() const {
+    return {host, device, state};
+  }
+
+  /// The fraction of the iteration space currently given to the host
+  /// execution space.
+  double host_fraction() const { return state->get_host_fraction(); }
+
+  template <typename F, typename... Ts> void post(F &&f, Ts &&...ts) {
+    executor<device_execution_space>(device).post(std::forward<F>(f),
+                                                  std::forward<Ts>(ts)...);
+  }
+
+  template <typename F, typename... Ts>
+  hpx::shared_future<void> async_execute(F &&f, Ts &&...ts) {
+    return executor<device_execution_space>(device).async_execute(
+        std::forward<F>(f), std::forward<Ts>(ts)...);
+  }
+
+  template <typename F, typename S, typename... Ts>
+  std::vector<hpx::shared_future<void>> bulk_async_execute(F &&f, S const &s,
+                                                           Ts &&...ts) {
+    return executor<device_execution_space>(device).bulk_async_execute(
+        std::forward<F>(f), s, std::forward<Ts>(ts)...);
+  }
+
+  hpx::shared_future<void> get_future() {
+    return detail::when_all_segments(
+        {detail::get_future<host_execution_space>::call(host),
+         detail::get_future<device_execution_space>::call(device)});
+  }
+
+  template <typename Parameters, typename F>
+  constexpr std::size_t get_chunk_size(Parameters &&params, F &&f,
+                                       std::size_t cores,
+                                       std::size_t count) const {
+    return std::size_t(-1);
+  }
+
+private:
+  host_execution_space host;
+  device_execution_space device;
+  std::shared_ptr<detail::co_execution_state> state;
+};
+
+template <typename HostExecutionSpace, typename DeviceExecutionSpace>
+struct is_kokkos_executor<co_executor<HostExecutionSpace, DeviceExecutionSpace>>
+    : std::true_type {};
+} // namespace kokkos
+} // namespace hpx
+
+namespace HPXKOKKOS_HPX_EXECUTOR_NS {
+template <typename HostExecutionSpace, typename DeviceExecutionSpace>
+struct is_one_way_executor<
+    hpx::kokkos::co_executor<HostExecutionSpace, DeviceExecutionSpace>>
+    : std::true_type {};
+
+template <typename HostExecutionSpace, typename DeviceExecutionSpace>
+struct is_two_way_executor<
+    hpx::kokkos::co_executor<HostExecutionSpace, DeviceExecutionSpace>>
+    : std::true_type {};
+
+template <typename HostExecutionSpace, typename DeviceExecutionSpace>
+struct is_bulk_two_way_executor<
+    hpx::kokkos::co_executor<HostExecutionSpace, DeviceExecutionSpace>>
+    : std::true_type {};
+} // namespace HPXKOKKOS_HPX_EXECUTOR_NS
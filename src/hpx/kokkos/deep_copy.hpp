@@ -10,21 +10,689 @@
 #pragma once
 
 #include <hpx/kokkos/future.hpp>
+#include <hpx/kokkos/performance_counters.hpp>
+#include <hpx/kokkos/scratch_arena.hpp>
+#include <hpx/kokkos/trace.hpp>
 
+#include <hpx/future.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace hpx {
 namespace kokkos {
+namespace detail {
+template <typename T> struct is_view_pair : std::false_type {};
+template <typename Dst, typename Src>
+struct is_view_pair<std::pair<Dst, Src>>
+    : std::integral_constant<bool, Kokkos::is_view<Dst>::value &&
+                                       Kokkos::is_view<Src>::value> {};
+
+template <typename T> struct is_view_pair_vector : std::false_type {};
+template <typename Pair, typename Allocator>
+struct is_view_pair_vector<std::vector<Pair, Allocator>> : is_view_pair<Pair> {
+};
+
+// Tells if the arguments of deep_copy_async after the execution space are a
+// batch of (destination, source) pairs.
+template <typename... Args>
+struct is_deep_copy_batch
+    : std::integral_constant<
+          bool,
+          (sizeof...(Args) > 0 &&
+           (is_view_pair<typename std::decay<Args>::type>::value && ...)) ||
+              (sizeof...(Args) == 1 &&
+               (is_view_pair_vector<typename std::decay<Args>::type>::value &&
+                ...))> {};
+
+// An unmanaged rank 1 view of the elements [b, e) of the span of a contiguous
+// view.
+template <typename View>
+using flat_view_t =
+    Kokkos::View<typename View::value_type *, typename View::memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+template <typename View>
+flat_view_t<View> flat_subview(View const &v, std::size_t const b,
+                               std::size_t const e) {
+  return flat_view_t<View>(v.data() + b, e - b);
+}
+
+// Returns the element of v at the flat index i, with indices ordered as in
+// LayoutRight. Packed buffers use this order regardless of the layout of v.
+template <typename View, std::size_t... Is>
+KOKKOS_INLINE_FUNCTION typename View::reference_type
+packed_element(View const &v, std::size_t i, std::index_sequence<Is...>) {
+  std::size_t idx[sizeof...(Is)];
+  for (std::size_t r = sizeof...(Is); r > 0; --r) {
+    idx[r - 1] = i % v.extent(r - 1);
+    i /= v.extent(r - 1);
+  }
+  return v(idx[Is]...);
+}
+
+template <typename ExecutionSpace, typename View, typename Buffer>
+void pack_view(ExecutionSpace const &instance, View const &v,
+               Buffer const &buffer) {
+  Kokkos::parallel_for(
+      "deep_copy_pack",
+      Kokkos::RangePolicy<ExecutionSpace>(instance, 0, buffer.extent(0)),
+      KOKKOS_LAMBDA(std::size_t const i) {
+        buffer(i) = packed_element(
+            v, i, std::make_index_sequence<std::size_t(View::rank)>());
+      });
+  count_kernel_launch<ExecutionSpace>();
+}
+
+template <typename ExecutionSpace, typename View, typename Buffer>
+void unpack_view(ExecutionSpace const &instance, View const &v,
+                 Buffer const &buffer) {
+  Kokkos::parallel_for(
+      "deep_copy_unpack",
+      Kokkos::RangePolicy<ExecutionSpace>(instance, 0, buffer.extent(0)),
+      KOKKOS_LAMBDA(std::size_t const i) {
+        packed_element(v, i,
+                       std::make_index_sequence<std::size_t(View::rank)>()) =
+            buffer(i);
+      });
+  count_kernel_launch<ExecutionSpace>();
+}
+
+// Tells if the elements of v are stored contiguously in the order used for
+// packed buffers.
+template <typename View> bool is_packed(View const &v) {
+  return v.span_is_contiguous() &&
+         (View::rank <= 1 || std::is_same<typename View::array_layout,
+                                          Kokkos::LayoutRight>::value);
+}
+
+template <typename ExecutionSpace, typename Dst, typename Src>
+struct can_pack_deep_copy_views
+    : std::integral_constant<
+          bool,
+          std::is_same<typename Dst::value_type,
+                       typename Dst::non_const_value_type>::value &&
+              std::is_same<typename Dst::non_const_value_type,
+                           typename Src::non_const_value_type>::value &&
+              unsigned(Dst::rank) == unsigned(Src::rank) && Dst::rank > 0 &&
+              // Kokkos already copies with a kernel on the instance when the
+              // execution space can access both views.
+              !(Kokkos::SpaceAccessibility<
+                    ExecutionSpace, typename Dst::memory_space>::accessible &&
+                Kokkos::SpaceAccessibility<
+                    ExecutionSpace, typename Src::memory_space>::accessible)> {
+};
+
+template <typename... Ts> struct can_pack_deep_copy : std::false_type {};
+template <typename ExecutionSpace, typename Dst, typename Src>
+struct can_pack_deep_copy<ExecutionSpace, Dst, Src>
+    : std::conjunction<Kokkos::is_view<Dst>, Kokkos::is_view<Src>,
+                       can_pack_deep_copy_views<ExecutionSpace, Dst, Src>> {};
+
+// Tells if the copy should be done through packed buffers, i.e. if one of the
+// views is not packed and every view that is not packed is accessible from the
+// execution space.
+template <typename ExecutionSpace, typename Dst, typename Src>
+bool use_packed_deep_copy(Dst const &dst, Src const &src) {
+  for (unsigned r = 0; r < Dst::rank; ++r) {
+    if (dst.extent(r) != src.extent(r)) {
+      return false;
+    }
+  }
+
+  bool const dst_packed = is_packed(dst);
+  bool const src_packed = is_packed(src);
+  return !(dst_packed && src_packed) &&
+         (dst_packed ||
+          Kokkos::SpaceAccessibility<ExecutionSpace,
+                                     typename Dst::memory_space>::accessible) &&
+         (src_packed ||
+          Kokkos::SpaceAccessibility<ExecutionSpace,
+                                     typename Src::memory_space>::accessible);
+}
+
+// Packs src into a contiguous buffer in its memory space, copies the buffer
+// in bulk to a contiguous buffer in the memory space of dst, and unpacks it
+// into dst, all enqueued on instance. Views that are already packed are used
+// directly as buffers. The buffers are allocated from the scratch arenas of
+// instance.
+template <typename ExecutionSpace, typename Dst, typename Src>
+hpx::shared_future<void> packed_deep_copy(ExecutionSpace const &instance,
+                                          Dst const &dst, Src const &src) {
+  using value_type = typename Dst::non_const_value_type;
+  using dst_memory_space = typename Dst::memory_space;
+  using src_memory_space = typename Src::memory_space;
+
+  std::size_t const n = dst.size();
+  scratch_lease<dst_memory_space> dst_lease;
+  scratch_lease<src_memory_space> src_lease;
+
+  flat_view_t<Src> src_buffer;
+  if (is_packed(src)) {
+    src_buffer = flat_subview(src, 0, n);
+  } else {
+    src_lease = get_scratch_arena<src_memory_space>(instance).acquire();
+    auto buffer = src_lease.template allocate<value_type>(n);
+    pack_view(instance, src, buffer);
+    src_buffer = buffer;
+  }
+
+  flat_view_t<Dst> dst_buffer;
+  if (is_packed(dst)) {
+    dst_buffer = flat_subview(dst, 0, n);
+  } else {
+    dst_lease = get_scratch_arena<dst_memory_space>(instance).acquire();
+    dst_buffer = dst_lease.template allocate<value_type>(n);
+  }
+
+  Kokkos::deep_copy(instance, dst_buffer, src_buffer);
+  if (!is_packed(dst)) {
+    unpack_view(instance, dst, dst_buffer);
+  }
+
+  return keep_alive(get_future<ExecutionSpace>::call(instance),
+                    std::move(dst_lease), std::move(src_lease));
+}
+
+// Copies between host views of at least this size are split across the
+// threads of the execution space.
+constexpr std::size_t parallel_host_copy_min_bytes = std::size_t(1) << 20;
+// Copies of at least this size use non-temporal stores, since the
+// destination would not fit in the caches anyway.
+constexpr std::size_t non_temporal_copy_min_bytes = std::size_t(32) << 20;
+
+inline void copy_bytes(char *dst, char const *src, std::size_t bytes,
+                       bool const non_temporal) {
+  if (dst == src) {
+    return;
+  }
+
+#if defined(__SSE2__)
+  if (non_temporal) {
+    // Stream stores require 16 byte aligned destinations.
+    std::size_t const head = (std::min)(
+        bytes, (16 - reinterpret_cast<std::uintptr_t>(dst) % 16) % 16);
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    bytes -= head;
+
+    std::size_t const n = bytes / 16;
+    for (std::size_t i = 0; i < n; ++i) {
+      _mm_stream_si128(reinterpret_cast<__m128i *>(dst) + i,
+                       _mm_loadu_si128(reinterpret_cast<__m128i const *>(src) +
+                                       i));
+    }
+    _mm_sfence();
+    std::memcpy(dst + n * 16, src + n * 16, bytes - n * 16);
+    return;
+  }
+#else
+  (void)non_temporal;
+#endif
+  std::memcpy(dst, src, bytes);
+}
+
+// Tells if dst and src have the same extents.
+template <typename Dst, typename Src>
+bool same_extents(Dst const &dst, Src const &src) {
+  for (unsigned r = 0; r < Dst::rank; ++r) {
+    if (dst.extent(r) != src.extent(r)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Tells if dst and src have the same extents and strides, i.e. if copying
+// the span of src to the span of dst copies each element to the
+// corresponding element.
+template <typename Dst, typename Src>
+bool same_memory_order(Dst const &dst, Src const &src) {
+  if (!same_extents(dst, src)) {
+    return false;
+  }
+  for (unsigned r = 0; r < Dst::rank; ++r) {
+    if (dst.stride(r) != src.stride(r)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename ExecutionSpace, typename Dst, typename Src>
+struct can_parallel_host_copy_views
+    : std::integral_constant<
+          bool,
+          std::is_same<typename Dst::value_type,
+                       typename Dst::non_const_value_type>::value &&
+              std::is_same<typename Dst::non_const_value_type,
+                           typename Src::non_const_value_type>::value &&
+              std::is_trivially_copyable<
+                  typename Dst::non_const_value_type>::value &&
+              unsigned(Dst::rank) == unsigned(Src::rank) &&
+              (Dst::rank <= 1 ||
+               std::is_same<typename Dst::array_layout,
+                            typename Src::array_layout>::value) &&
+              Kokkos::SpaceAccessibility<
+                  Kokkos::HostSpace, typename ExecutionSpace::memory_space>::
+                  accessible &&
+              Kokkos::SpaceAccessibility<
+                  ExecutionSpace, typename Dst::memory_space>::accessible &&
+              Kokkos::SpaceAccessibility<
+                  ExecutionSpace, typename Src::memory_space>::accessible &&
+              Kokkos::SpaceAccessibility<
+                  Kokkos::HostSpace, typename Dst::memory_space>::accessible &&
+              Kokkos::SpaceAccessibility<
+                  Kokkos::HostSpace, typename Src::memory_space>::accessible> {
+};
+
+template <typename... Ts> struct can_parallel_host_copy : std::false_type {};
+template <typename ExecutionSpace, typename Dst, typename Src>
+struct can_parallel_host_copy<ExecutionSpace, Dst, Src>
+    : std::conjunction<
+          Kokkos::is_view<Dst>, Kokkos::is_view<Src>,
+          can_parallel_host_copy_views<ExecutionSpace, Dst, Src>> {};
+
+template <typename ExecutionSpace, typename Dst, typename Src>
+bool use_parallel_host_copy(ExecutionSpace const &instance, Dst const &dst,
+                            Src const &src) {
+  if (instance.concurrency() <= 1 || !dst.span_is_contiguous() ||
+      !src.span_is_contiguous() ||
+      dst.span() * sizeof(typename Dst::value_type) <
+          parallel_host_copy_min_bytes) {
+    return false;
+  }
+  // Contiguous LayoutStride views may still order their elements
+  // differently, e.g. when one is the transpose of the other.
+  if (!same_memory_order(dst, src)) {
+    return false;
+  }
+
+  // Partially overlapping views are left to Kokkos::deep_copy. Views with
+  // the same data are handled by parallel_host_copy.
+  auto const *const d = reinterpret_cast<char const *>(dst.data());
+  auto const *const s = reinterpret_cast<char const *>(src.data());
+  std::size_t const bytes = dst.span() * sizeof(typename Dst::value_type);
+  return d == s || d + bytes <= s || s + bytes <= d;
+}
+
+// Copies contiguous host views with one chunk per thread of the execution
+// space. The chunks are scheduled statically, like the kernels that usually
+// first touch the views, so that each thread copies memory local to its NUMA
+// domain.
+template <typename ExecutionSpace, typename Dst, typename Src>
+hpx::shared_future<void> parallel_host_copy(ExecutionSpace const &instance,
+                                            Dst const &dst, Src const &src) {
+  std::size_t const bytes = dst.span() * sizeof(typename Dst::value_type);
+  std::size_t const num_chunks = instance.concurrency();
+  std::size_t const chunk_bytes = (bytes + num_chunks - 1) / num_chunks;
+  bool const non_temporal = bytes >= non_temporal_copy_min_bytes;
+  char *const d = reinterpret_cast<char *>(dst.data());
+  char const *const s = reinterpret_cast<char const *>(src.data());
+
+  // Copying a view onto itself does nothing, but the returned future still
+  // waits for earlier work on the instance.
+  if (d == s) {
+    return get_future<ExecutionSpace>::call(instance);
+  }
+
+  Kokkos::parallel_for(
+      "deep_copy_parallel_host",
+      Kokkos::Experimental::require(
+          Kokkos::RangePolicy<ExecutionSpace,
+                              Kokkos::Schedule<Kokkos::Static>>(instance, 0,
+                                                                num_chunks),
+          Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+      KOKKOS_LAMBDA(std::size_t const c) {
+        std::size_t const b = (std::min)(bytes, c * chunk_bytes);
+        std::size_t const e = (std::min)(bytes, b + chunk_bytes);
+        copy_bytes(d + b, s + b, e - b, non_temporal);
+      });
+  count_kernel_launch<ExecutionSpace>();
+
+  return get_future<ExecutionSpace>::call(instance);
+}
+} // namespace detail
+
 // TODO: Do we need more overloads here?
 template <typename ExecutionSpace, typename... Args,
-          typename Enable = typename std::enable_if<Kokkos::is_execution_space<
-              typename std::decay<ExecutionSpace>::type>::value>::type>
+          typename Enable = typename std::enable_if<
+              Kokkos::is_execution_space<
+                  typename std::decay<ExecutionSpace>::type>::value &&
+              !detail::is_deep_copy_batch<Args...>::value>::type>
 hpx::shared_future<void> deep_copy_async(ExecutionSpace &&space,
                                          Args &&...args) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+  detail::trace_start_time const trace_start = detail::trace_begin();
+
+  // Large copies between host views are split across the threads of host
+  // execution spaces, since Kokkos may copy them with a single thread.
+  if constexpr (detail::can_parallel_host_copy<
+                    execution_space,
+                    typename std::decay<Args>::type...>::value) {
+    if (detail::use_parallel_host_copy(space, args...)) {
+      return detail::trace_deep_copy(
+          space, trace_start, detail::parallel_host_copy(space, args...));
+    }
+  }
+
+  // Non-contiguous views are packed and unpacked with kernels on the
+  // instance, so that the copy between memory spaces is done in bulk.
+  if constexpr (detail::can_pack_deep_copy<
+                    execution_space,
+                    typename std::decay<Args>::type...>::value) {
+    if (detail::use_packed_deep_copy<execution_space>(args...)) {
+      return detail::trace_deep_copy(
+          space, trace_start, detail::packed_deep_copy(space, args...));
+    }
+  }
+
   Kokkos::deep_copy(space, std::forward<Args>(args)...);
-  return detail::get_future<typename std::decay<ExecutionSpace>::type>::call(
-      std::forward<ExecutionSpace>(space));
+  return detail::trace_deep_copy(
+      space, trace_start,
+      detail::get_future<typename std::decay<ExecutionSpace>::type>::call(
+          space));
+}
+
+/// Returns the bounds [b, e) of chunk c when splitting n elements into
+/// num_chunks chunks of (almost) equal size, as done by
+/// deep_copy_chunked_async. Throws if num_chunks is zero.
+inline std::pair<std::size_t, std::size_t>
+get_chunk_bounds(std::size_t const n, std::size_t const num_chunks,
+                 std::size_t const c) {
+  if (num_chunks == 0) {
+    throw std::runtime_error("get_chunk_bounds: num_chunks must be at least 1");
+  }
+  std::size_t const chunk_size = (n + num_chunks - 1) / num_chunks;
+  std::size_t const b = (std::min)(n, c * chunk_size);
+  std::size_t const e = (std::min)(n, b + chunk_size);
+  return {b, e};
+}
+
+namespace detail {
+template <typename Dst, typename Src>
+void check_chunked_copy_views(Dst const &dst, Src const &src) {
+  static_assert(std::is_same<typename Dst::value_type,
+                             typename Dst::non_const_value_type>::value,
+                "deep_copy_chunked_async requires a non-const destination");
+  static_assert(std::is_same<typename Dst::non_const_value_type,
+                             typename Src::non_const_value_type>::value,
+                "deep_copy_chunked_async requires the same value types");
+  static_assert(unsigned(Dst::rank) == unsigned(Src::rank),
+                "deep_copy_chunked_async requires views of equal rank");
+  static_assert(Dst::rank <= 1 ||
+                    std::is_same<typename Dst::array_layout,
+                                 typename Src::array_layout>::value,
+                "deep_copy_chunked_async requires the same layout for views "
+                "of rank 2 or higher");
+
+  if (!dst.span_is_contiguous() || !src.span_is_contiguous()) {
+    throw std::runtime_error(
+        "deep_copy_chunked_async: source and destination must be contiguous");
+  }
+  for (unsigned r = 0; r < Dst::rank; ++r) {
+    if (dst.extent(r) != src.extent(r)) {
+      throw std::runtime_error(
+          "deep_copy_chunked_async: extents of source and destination differ");
+    }
+  }
+}
+} // namespace detail
+
+/// \brief Copies src to dst in num_chunks chunks, enqueued one after the other
+/// on space. Both views must be contiguous and have the same extents (and
+/// layout for rank 2 or higher). Chunks are contiguous pieces of the span of
+/// the views, i.e. for rank 1 views chunk c covers the indices returned by
+/// get_chunk_bounds. Returns one future per chunk, which becomes ready when
+/// that chunk has been copied. Work depending on chunk c can start while later
+/// chunks are still being copied. Throws if num_chunks is zero. If num_chunks
+/// is larger than the number of elements, one chunk per element is used.
+template <typename ExecutionSpace, typename Dst, typename Src,
+          typename Enable = typename std::enable_if<Kokkos::is_execution_space<
+              typename std::decay<ExecutionSpace>::type>::value>::type>
+std::vector<hpx::shared_future<void>>
+deep_copy_chunked_async(ExecutionSpace &&space, Dst const &dst,
+                        Src const &src, std::size_t const num_chunks) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+
+  if (num_chunks == 0) {
+    throw std::runtime_error(
+        "deep_copy_chunked_async: num_chunks must be at least 1");
+  }
+  detail::check_chunked_copy_views(dst, src);
+
+  std::size_t const n = dst.span();
+  std::size_t const chunks = (std::min)(n, num_chunks);
+  std::vector<hpx::shared_future<void>> futures;
+  futures.reserve(chunks);
+  for (std::size_t c = 0; c < chunks; ++c) {
+    auto const bounds = get_chunk_bounds(n, chunks, c);
+    Kokkos::deep_copy(space,
+                      detail::flat_subview(dst, bounds.first, bounds.second),
+                      detail::flat_subview(src, bounds.first, bounds.second));
+    futures.push_back(detail::get_future<execution_space>::call(space));
+  }
+
+  return futures;
+}
+
+/// \brief Copies src to dst in num_chunks chunks like the overload returning
+/// one future per chunk, calling on_chunk_ready(b, e) with the bounds of each
+/// chunk once it has been copied. Returns a future that becomes ready when all
+/// chunks have been copied and on_chunk_ready has returned for all of them.
+template <typename ExecutionSpace, typename Dst, typename Src, typename F,
+          typename Enable = typename std::enable_if<Kokkos::is_execution_space<
+              typename std::decay<ExecutionSpace>::type>::value>::type>
+hpx::shared_future<void>
+deep_copy_chunked_async(ExecutionSpace &&space, Dst const &dst,
+                        Src const &src, std::size_t const num_chunks,
+                        F &&on_chunk_ready) {
+  auto futures = deep_copy_chunked_async(std::forward<ExecutionSpace>(space),
+                                         dst, src, num_chunks);
+
+  std::size_t const chunks = futures.size();
+  std::vector<hpx::shared_future<void>> ready;
+  ready.reserve(chunks);
+  for (std::size_t c = 0; c < chunks; ++c) {
+    auto const bounds = get_chunk_bounds(dst.span(), chunks, c);
+    ready.push_back(futures[c].then(
+        hpx::launch::sync,
+        [on_chunk_ready, bounds](hpx::shared_future<void> &&f) {
+          f.get();
+          on_chunk_ready(bounds.first, bounds.second);
+        }));
+  }
+
+  return hpx::when_all(std::move(ready))
+      .then(hpx::launch::sync,
+            [](hpx::future<std::vector<hpx::shared_future<void>>> &&f) {
+              for (auto &fut : f.get()) {
+                fut.get();
+              }
+            });
+}
+
+namespace detail {
+// Copies with at most this many bytes on average are gathered into a single
+// kernel. Larger copies are issued as separate deep copies, which use the
+// native copy engines.
+constexpr std::size_t batched_copy_max_average_bytes = std::size_t(1) << 16;
+
+template <typename T> struct batched_copy_descriptor {
+  T *dst;
+  T const *src;
+  std::size_t size;
+};
+
+template <typename ExecutionSpace, typename Dst, typename Src>
+struct can_batch_copy_in_kernel
+    : std::integral_constant<
+          bool,
+          std::is_same<typename Dst::non_const_value_type,
+                       typename Src::non_const_value_type>::value &&
+              unsigned(Dst::rank) == unsigned(Src::rank) &&
+              (Dst::rank <= 1 ||
+               std::is_same<typename Dst::array_layout,
+                            typename Src::array_layout>::value) &&
+              Kokkos::SpaceAccessibility<
+                  ExecutionSpace, typename Dst::memory_space>::accessible &&
+              Kokkos::SpaceAccessibility<
+                  ExecutionSpace, typename Src::memory_space>::accessible> {};
+
+// Copies the pair described by each descriptor with one team per pair.
+template <typename ExecutionSpace, typename Descriptors>
+void launch_deep_copy_batch(ExecutionSpace const &instance,
+                            Descriptors const &descriptors) {
+  using descriptor_type = typename Descriptors::non_const_value_type;
+  using team_member_type =
+      typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+  Kokkos::parallel_for(
+      "deep_copy_batch",
+      Kokkos::TeamPolicy<ExecutionSpace>(instance, descriptors.extent(0),
+                                         Kokkos::AUTO),
+      KOKKOS_LAMBDA(team_member_type const &member) {
+        descriptor_type const d = descriptors(member.league_rank());
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(member, d.size),
+            [&](std::size_t const j) { d.dst[j] = d.src[j]; });
+      });
+  count_kernel_launch<ExecutionSpace>();
+}
+
+// The descriptors are staged in host memory and, if the execution space can
+// not access host memory, copied to scratch memory of the instance.
+template <typename ExecutionSpace, typename Dst, typename Src,
+          typename Allocator>
+hpx::shared_future<void> deep_copy_batch_kernel(
+    ExecutionSpace const &instance,
+    std::vector<std::pair<Dst, Src>, Allocator> const &pairs) {
+  using descriptor_type =
+      batched_copy_descriptor<typename Dst::non_const_value_type>;
+  using host_view_type = Kokkos::View<descriptor_type *, Kokkos::HostSpace>;
+
+  host_view_type host_descriptors(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                         "deep_copy_batch_descriptors"),
+      pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    host_descriptors(i) = {pairs[i].first.data(), pairs[i].second.data(),
+                           pairs[i].first.span()};
+  }
+
+  if constexpr (Kokkos::SpaceAccessibility<ExecutionSpace,
+                                           Kokkos::HostSpace>::accessible) {
+    launch_deep_copy_batch(instance, host_descriptors);
+    return keep_alive(get_future<ExecutionSpace>::call(instance),
+                      std::move(host_descriptors));
+  } else {
+    using memory_space = typename ExecutionSpace::memory_space;
+    auto lease = get_scratch_arena<memory_space>(instance).acquire();
+    auto descriptors = lease.template allocate<descriptor_type>(pairs.size());
+    Kokkos::deep_copy(instance, descriptors, host_descriptors);
+    launch_deep_copy_batch(instance, descriptors);
+    return keep_alive(get_future<ExecutionSpace>::call(instance),
+                      std::move(host_descriptors), std::move(lease));
+  }
+}
+} // namespace detail
+
+/// \brief Copies a batch of (destination, source) view pairs on space and
+/// returns a single future that becomes ready when all copies have completed.
+/// If the value types match, all views are contiguous with the same strides
+/// and accessible from space, and the copies are small, they are done by a
+/// single gather/scatter kernel instead of one deep copy per pair. Throws
+/// std::runtime_error if the extents of a pair differ.
+template <typename ExecutionSpace, typename Dst, typename Src,
+          typename Allocator,
+          typename Enable = typename std::enable_if<Kokkos::is_execution_space<
+              typename std::decay<ExecutionSpace>::type>::value>::type>
+hpx::shared_future<void>
+deep_copy_async(ExecutionSpace &&space,
+                std::vector<std::pair<Dst, Src>, Allocator> const &pairs) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+
+  if (pairs.empty()) {
+    return hpx::make_ready_future();
+  }
+
+  for (auto const &p : pairs) {
+    if (!detail::same_extents(p.first, p.second)) {
+      throw std::runtime_error(
+          "deep_copy_async: extents of source and destination differ");
+    }
+  }
+
+  detail::trace_start_time const trace_start = detail::trace_begin();
+
+  if constexpr (detail::can_batch_copy_in_kernel<execution_space, Dst,
+                                                 Src>::value) {
+    std::size_t total_size = 0;
+    bool contiguous = true;
+    for (auto const &p : pairs) {
+      // Views with different strides, e.g. transposed LayoutStride views,
+      // are left to Kokkos::deep_copy.
+      contiguous = contiguous && p.first.span_is_contiguous() &&
+                   p.second.span_is_contiguous() &&
+                   detail::same_memory_order(p.first, p.second);
+      total_size += p.first.span();
+    }
+
+    if (contiguous &&
+        total_size * sizeof(typename Dst::value_type) <=
+            pairs.size() * detail::batched_copy_max_average_bytes) {
+      return detail::trace_deep_copy(
+          space, trace_start, detail::deep_copy_batch_kernel(space, pairs));
+    }
+  }
+
+  for (auto const &p : pairs) {
+    Kokkos::deep_copy(space, p.first, p.second);
+  }
+  return detail::trace_deep_copy(
+      space, trace_start, detail::get_future<execution_space>::call(space));
+}
+
+/// \brief Copies the given (destination, source) view pairs on space and
+/// returns a single future. Pairs of the same type are copied as by the
+/// overload taking a vector of pairs.
+template <typename ExecutionSpace, typename... Dsts, typename... Srcs,
+          typename Enable = typename std::enable_if<
+              Kokkos::is_execution_space<
+                  typename std::decay<ExecutionSpace>::type>::value &&
+              (sizeof...(Dsts) > 0)>::type>
+hpx::shared_future<void>
+deep_copy_async(ExecutionSpace &&space, std::pair<Dsts, Srcs> const &...pairs) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+  using first_pair_type = typename std::tuple_element<
+      0, std::tuple<std::pair<Dsts, Srcs>...>>::type;
+
+  if constexpr ((std::is_same<std::pair<Dsts, Srcs>, first_pair_type>::value &&
+                 ...)) {
+    return deep_copy_async(std::forward<ExecutionSpace>(space),
+                           std::vector<first_pair_type>{pairs...});
+  } else {
+    detail::trace_start_time const trace_start = detail::trace_begin();
+    (Kokkos::deep_copy(space, pairs.first, pairs.second), ...);
+    return detail::trace_deep_copy(
+        space, trace_start, detail::get_future<execution_space>::call(space));
+  }
 }
+
 #if defined(KOKKOS_ENABLE_SYCL)
 #if !defined(HPX_KOKKOS_SYCL_FUTURE_TYPE)
 // polling is default (0) as it is simply faster)
@@ -36,7 +704,11 @@ hpx::shared_future<void> deep_copy_async(ExecutionSpace &&space,
 /// of not having to create our own sycl::event in get_future - instead it uses
 /// the copy event directly by circumventing kokkos::deep_copy and running
 /// sycl:memcpy itself. This reduces the overhead. 
-template <typename TargetSpace, typename SourceSpace>
+template <typename TargetSpace, typename SourceSpace,
+          typename Enable = typename std::enable_if<
+              Kokkos::is_view<typename std::decay<TargetSpace>::type>::value &&
+              Kokkos::is_view<
+                  typename std::decay<SourceSpace>::type>::value>::type>
 hpx::shared_future<void> deep_copy_async(Kokkos::Experimental::SYCL &&instance,
                                          TargetSpace &&t, SourceSpace &&s) {
   // Usually, Kokkos does a bunch of safety checks before deep copies. Here, we
@@ -66,6 +738,17 @@ hpx::shared_future<void> deep_copy_async(Kokkos::Experimental::SYCL &&instance,
 
   // Safety checks 2: Check that there's no dimension mismatch and that the memory is contiguous
   if (!t.span_is_contiguous() || !s.span_is_contiguous()) {
+    // Non-contiguous views are packed and unpacked with kernels on the
+    // instance, as in the generic overload, so that the copy itself is done
+    // on contiguous buffers.
+    if constexpr (detail::can_pack_deep_copy<
+                      Kokkos::Experimental::SYCL,
+                      typename std::decay<TargetSpace>::type,
+                      typename std::decay<SourceSpace>::type>::value) {
+      if (detail::use_packed_deep_copy<Kokkos::Experimental::SYCL>(t, s)) {
+        return detail::packed_deep_copy(instance, t, s);
+      }
+    }
     throw std::runtime_error(
         "deep_copy_async: Both source and target SYCL views must be contiguous");
   }
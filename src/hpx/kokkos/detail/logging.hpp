@@ -6,7 +6,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 /// \file Logging functionality. Provides HPX_KOKKOS_DETAIL_LOG for internal
-/// logging.
+/// logging. Logging is meant for debugging and is compiled out unless
+/// HPX_KOKKOS_ENABLE_LOGGING is defined. See hpx/kokkos/trace.hpp for tracing
+/// kernels, fences, and copies at runtime.
 
 #pragma once
 
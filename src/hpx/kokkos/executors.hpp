@@ -15,12 +15,18 @@
 #include <hpx/kokkos/make_instance.hpp>
 
 #include <hpx/algorithm.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/future.hpp>
 #include <hpx/numeric.hpp>
 #include <hpx/tuple.hpp>
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace hpx {
 namespace kokkos {
@@ -99,7 +105,6 @@ public:
             Kokkos::RangePolicy<ExecutionSpace>(inst, 0, size),
             Kokkos::Experimental::WorkItemProperty::HintLightWeight),
         KOKKOS_LAMBDA(int i) {
-          HPX_KOKKOS_DETAIL_LOG("bulk_async_execute i = %d", i);
           using index_pack_type =
 #if HPX_VERSION_FULL > 0x010801
             typename hpx::detail::fused_index_pack<decltype(ts_pack)>::type;
@@ -126,6 +131,143 @@ private:
   execution_space inst{};
 };
 
+/// \brief A set of Kokkos execution space instances. Used with
+/// segmented_executor to split parallel algorithms over multiple instances.
+template <typename ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class instance_set {
+public:
+  using execution_space = ExecutionSpace;
+
+  instance_set() = default;
+  explicit instance_set(std::vector<execution_space> instances)
+      : instances(std::move(instances)) {}
+
+  std::size_t size() const { return instances.size(); }
+  execution_space const &operator[](std::size_t const i) const {
+    return instances[i];
+  }
+
+private:
+  std::vector<execution_space> instances;
+};
+
+namespace detail {
+// True if T is a single execution space instance, as opposed to the instances
+// of a segmented_executor or co_executor. Algorithms that do not split their
+// range between instances require a single instance.
+template <typename T>
+struct is_single_instance
+    : Kokkos::is_execution_space<typename std::decay<T>::type> {};
+
+// Returns the bounds of segment i when splitting n elements into num_segments
+// segments of (almost) equal size.
+inline std::pair<std::size_t, std::size_t>
+get_segment_bounds(std::size_t const n, std::size_t const num_segments,
+                   std::size_t const i) {
+  std::size_t const segment_size = (n + num_segments - 1) / num_segments;
+  std::size_t const b = (std::min)(n, i * segment_size);
+  std::size_t const e = (std::min)(n, b + segment_size);
+  return {b, e};
+}
+
+inline hpx::shared_future<void>
+when_all_segments(std::vector<hpx::shared_future<void>> &&futures) {
+  return hpx::when_all(std::move(futures))
+      .then(hpx::launch::sync,
+            [](hpx::future<std::vector<hpx::shared_future<void>>> &&f) {
+              for (auto &fut : f.get()) {
+                fut.get();
+              }
+            });
+}
+} // namespace detail
+
+/// \brief HPX executor splitting work over a set of Kokkos execution space
+/// instances. The parallel algorithm specializations (for_each, for_loop, and
+/// reduce over one-dimensional ranges) split the range into one segment per
+/// instance, launch each segment on its own instance, and combine the
+/// results. With independent instances the segments may run concurrently.
+template <typename ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class segmented_executor {
+public:
+  using execution_space = ExecutionSpace;
+  using execution_category = hpx::execution::parallel_execution_tag;
+
+  explicit segmented_executor(instance_set<ExecutionSpace> instances)
+      : instances(std::move(instances)) {
+    HPX_ASSERT(this->instances.size() > 0);
+  }
+
+  instance_set<execution_space> instance() const { return instances; }
+
+  template <typename F, typename... Ts> void post(F &&f, Ts &&...ts) {
+    executor<execution_space>(instances[0])
+        .post(std::forward<F>(f), std::forward<Ts>(ts)...);
+  }
+
+  template <typename F, typename... Ts>
+  hpx::shared_future<void> async_execute(F &&f, Ts &&...ts) {
+    return executor<execution_space>(instances[0])
+        .async_execute(std::forward<F>(f), std::forward<Ts>(ts)...);
+  }
+
+  template <typename F, typename S, typename... Ts>
+  std::vector<hpx::shared_future<void>> bulk_async_execute(F &&f, S const &s,
+                                                           Ts &&...ts) {
+    HPX_KOKKOS_DETAIL_LOG("segmented bulk_async_execute");
+    auto ts_pack = hpx::make_tuple(std::forward<Ts>(ts)...);
+    auto const size = hpx::util::size(s);
+    auto const b = hpx::util::begin(s);
+
+    std::vector<hpx::shared_future<void>> futures;
+    futures.reserve(instances.size());
+    for (std::size_t i = 0; i < instances.size(); ++i) {
+      auto const bounds = detail::get_segment_bounds(size, instances.size(), i);
+      if (bounds.first == bounds.second) {
+        continue;
+      }
+
+      futures.push_back(parallel_for_async(
+          Kokkos::Experimental::require(
+              Kokkos::RangePolicy<ExecutionSpace>(instances[i], bounds.first,
+                                                  bounds.second),
+              Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+          KOKKOS_LAMBDA(int j) {
+            using index_pack_type =
+#if HPX_VERSION_FULL > 0x010801
+                typename hpx::detail::fused_index_pack<decltype(ts_pack)>::type;
+#else
+                typename hpx::util::detail::fused_index_pack<
+                    decltype(ts_pack)>::type;
+#endif
+            detail::invoke_helper(index_pack_type{}, f, *(b + j), ts_pack);
+          }));
+    }
+
+    return futures;
+  }
+
+  hpx::shared_future<void> get_future() {
+    std::vector<hpx::shared_future<void>> futures;
+    futures.reserve(instances.size());
+    for (std::size_t i = 0; i < instances.size(); ++i) {
+      futures.push_back(
+          detail::get_future<execution_space>::call(instances[i]));
+    }
+    return detail::when_all_segments(std::move(futures));
+  }
+
+  template <typename Parameters, typename F>
+  constexpr std::size_t get_chunk_size(Parameters &&params, F &&f,
+                                       std::size_t cores,
+                                       std::size_t count) const {
+    return std::size_t(-1);
+  }
+
+private:
+  instance_set<execution_space> instances;
+};
+
 // Define type aliases
 using default_executor = executor<Kokkos::DefaultExecutionSpace>;
 using default_host_executor = executor<Kokkos::DefaultHostExecutionSpace>;
@@ -158,6 +300,10 @@ template <typename Executor> struct is_kokkos_executor : std::false_type {};
 
 template <typename ExecutionSpace>
 struct is_kokkos_executor<executor<ExecutionSpace>> : std::true_type {};
+
+template <typename ExecutionSpace>
+struct is_kokkos_executor<segmented_executor<ExecutionSpace>>
+    : std::true_type {};
 } // namespace kokkos
 } // namespace hpx
 
@@ -173,4 +319,16 @@ struct is_two_way_executor<hpx::kokkos::executor<ExecutionSpace>>
 template <typename ExecutionSpace>
 struct is_bulk_two_way_executor<hpx::kokkos::executor<ExecutionSpace>>
     : std::true_type {};
+
+template <typename ExecutionSpace>
+struct is_one_way_executor<hpx::kokkos::segmented_executor<ExecutionSpace>>
+    : std::true_type {};
+
+template <typename ExecutionSpace>
+struct is_two_way_executor<hpx::kokkos::segmented_executor<ExecutionSpace>>
+    : std::true_type {};
+
+template <typename ExecutionSpace>
+struct is_bulk_two_way_executor<
+    hpx::kokkos::segmented_executor<ExecutionSpace>> : std::true_type {};
 } // namespace HPXKOKKOS_HPX_EXECUTOR_NS
@@ -10,10 +10,14 @@
 
 #pragma once
 
+#include <hpx/kokkos/adaptive_polling.hpp>
 #include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/performance_counters.hpp>
+#include <hpx/kokkos/trace.hpp>
 
 #include <hpx/config.hpp>
 #include <hpx/future.hpp>
+#include <hpx/tuple.hpp>
 
 #if defined(HPX_HAVE_CUDA) || defined(HPX_HAVE_HIP)
 #include <hpx/modules/async_cuda.hpp>
@@ -24,9 +28,16 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <type_traits>
+
 namespace hpx {
 namespace kokkos {
 namespace detail {
+// True if get_future<ExecutionSpace> returns a future that becomes ready
+// asynchronously, and false if it fences the instance.
+template <typename ExecutionSpace>
+struct has_async_get_future : std::false_type {};
+
 template <typename ExecutionSpace = Kokkos::DefaultExecutionSpace>
 struct get_future {
   template <typename E> static hpx::shared_future<void> call(E &&inst) {
@@ -34,47 +45,65 @@ struct get_future {
     // instance and return a ready future. It would be nice to be able to
     // attach a callback to any execution space instance to trigger future
     // completion.
-    inst.fence();
+    traced_fence(inst);
+    count_fence_fallback();
     HPX_KOKKOS_DETAIL_LOG("getting generic ready future after fencing");
-    return hpx::make_ready_future();
+    return count_future(hpx::make_ready_future());
   }
 };
 
 #if defined(KOKKOS_ENABLE_CUDA)
+template <>
+struct has_async_get_future<Kokkos::Cuda> : std::true_type {};
+
 template <> struct get_future<Kokkos::Cuda> {
   template <typename E> static hpx::shared_future<void> call(E &&inst) {
     HPX_KOKKOS_DETAIL_LOG("getting future from stream %p", inst.cuda_stream());
 #if HPX_KOKKOS_CUDA_FUTURE_TYPE == 0
-    return hpx::cuda::experimental::detail::get_future_with_event(
-        inst.cuda_stream());
+    return count_future(hpx::cuda::experimental::detail::get_future_with_event(
+        inst.cuda_stream()));
 #elif HPX_KOKKOS_CUDA_FUTURE_TYPE == 1
-    return hpx::cuda::experimental::detail::get_future_with_callback(
-        inst.cuda_stream());
+    return count_future(
+        hpx::cuda::experimental::detail::get_future_with_callback(
+            inst.cuda_stream()));
+#elif HPX_KOKKOS_CUDA_FUTURE_TYPE == 2
+    return count_future(
+        get_future_with_adaptive_polling<cuda_event_api>(inst.cuda_stream()));
 #else
-#error "HPX_KOKKOS_CUDA_FUTURE_TYPE is invalid (must be 0 (event) or 1 (callback))"
+#error "HPX_KOKKOS_CUDA_FUTURE_TYPE is invalid (must be 0 (event), 1 (callback), or 2 (adaptive))"
 #endif
   }
 };
 #endif
 
 #if defined(KOKKOS_ENABLE_HIP)
+template <>
+struct has_async_get_future<Kokkos::Experimental::HIP> : std::true_type {};
+
 template <> struct get_future<Kokkos::Experimental::HIP> {
   template <typename E> static hpx::shared_future<void> call(E &&inst) {
     HPX_KOKKOS_DETAIL_LOG("getting future from stream %p", inst.hip_stream());
 #if HPX_KOKKOS_CUDA_FUTURE_TYPE == 0
-    return hpx::cuda::experimental::detail::get_future_with_event(
-        inst.hip_stream());
+    return count_future(hpx::cuda::experimental::detail::get_future_with_event(
+        inst.hip_stream()));
 #elif HPX_KOKKOS_CUDA_FUTURE_TYPE == 1
-    return hpx::cuda::experimental::detail::get_future_with_callback(
-        inst.hip_stream());
+    return count_future(
+        hpx::cuda::experimental::detail::get_future_with_callback(
+            inst.hip_stream()));
+#elif HPX_KOKKOS_CUDA_FUTURE_TYPE == 2
+    return count_future(
+        get_future_with_adaptive_polling<hip_event_api>(inst.hip_stream()));
 #else
-#error "HPX_KOKKOS_CUDA_FUTURE_TYPE is invalid (must be 0 (event) or 1 (callback))"
+#error "HPX_KOKKOS_CUDA_FUTURE_TYPE is invalid (must be 0 (event), 1 (callback), or 2 (adaptive))"
 #endif
   }
 };
 #endif
 
 #if defined(KOKKOS_ENABLE_SYCL)
+template <>
+struct has_async_get_future<Kokkos::Experimental::SYCL> : std::true_type {};
+
 template <> struct get_future<Kokkos::Experimental::SYCL> {
   template <typename E> static hpx::shared_future<void> call(E &&inst) {
     HPX_KOKKOS_DETAIL_LOG("getting future from SYCL queue %p", &(inst.sycl_queue()));
@@ -86,17 +115,20 @@ template <> struct get_future<Kokkos::Experimental::SYCL> {
 #else
 #error "HPX_KOKKOS_SYCL_FUTURE_TYPE is invalid (must be 0 (event) or 1 (host_task))"
 #endif
-    return fut ;
+    return count_future(std::move(fut));
   }
 };
 #endif
 
 #if defined(KOKKOS_ENABLE_HPX) 
+template <>
+struct has_async_get_future<Kokkos::Experimental::HPX> : std::true_type {};
+
 template <> struct get_future<Kokkos::Experimental::HPX> {
   template <typename E> static hpx::shared_future<void> call(E &&inst) {
     HPX_KOKKOS_DETAIL_LOG("getting future from HPX instance %x",
                           inst.impl_instance_id());
-    return inst.impl_get_future();
+    return count_future(inst.impl_get_future());
   }
 };
 #endif
@@ -118,5 +150,32 @@ template <typename ExecutionSpace = Kokkos::DefaultExecutionSpace>
 hpx::shared_future<void> get_future() {
   return detail::get_future<ExecutionSpace>::call(ExecutionSpace());
 }
+
+/// Keeps ts (typically views used by the work that f represents) alive until
+/// f is ready. The last references held here are released in an HPX
+/// continuation on a worker thread once f is ready, so that dropping the
+/// caller's references neither races with the work nor blocks the calling
+/// thread on deallocation. Returns f. Example:
+///
+///   auto f = hpx::kokkos::keep_alive(
+///       hpx::kokkos::parallel_for_async(policy, functor), tmp);
+template <typename R, typename... Ts>
+hpx::shared_future<R> keep_alive(hpx::shared_future<R> f, Ts &&...ts) {
+  f.then(hpx::launch::async,
+         [ts = hpx::make_tuple(std::forward<Ts>(ts)...)](
+             hpx::shared_future<R> &&) mutable {
+           // Moving out of the continuation releases the references on this
+           // thread instead of wherever the continuation is destroyed.
+           auto released = std::move(ts);
+         });
+  return f;
+}
+
+/// \copydoc keep_alive
+template <typename R, typename... Ts>
+hpx::shared_future<R> keep_alive(hpx::future<R> &&f, Ts &&...ts) {
+  return keep_alive(hpx::shared_future<R>(std::move(f)),
+                    std::forward<Ts>(ts)...);
+}
 } // namespace kokkos
 } // namespace hpx
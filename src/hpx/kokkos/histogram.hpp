@@ -0,0 +1,354 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains an asynchronous histogram (bin count) algorithm. The strategy used
+/// to avoid contention on the bins is chosen based on the number of bins.
+
+#pragma once
+
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/future.hpp>
+#include <hpx/kokkos/performance_counters.hpp>
+#include <hpx/kokkos/pipeline.hpp>
+#include <hpx/kokkos/policy.hpp>
+#include <hpx/kokkos/scratch_arena.hpp>
+
+#include <hpx/functional.hpp>
+#include <hpx/future.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+namespace kokkos {
+/// Strategies for accumulating into the bins of a histogram.
+enum class histogram_strategy {
+  /// Choose a strategy based on the number of bins.
+  automatic,
+  /// Each chunk of the input accumulates into private bins. On host
+  /// execution spaces the private bins are merged in a second kernel. On
+  /// device execution spaces each team accumulates into bins in team scratch
+  /// memory, which are added to the result with atomics. Suitable for a small
+  /// number of bins.
+  privatized,
+  /// Accumulate through a Kokkos::Experimental::ScatterView, which
+  /// duplicates the bins per thread on host execution spaces and uses
+  /// atomics on device execution spaces. Suitable for a medium number of
+  /// bins.
+  scatter_view,
+  /// Accumulate directly into the bins with atomics. Suitable for a large
+  /// number of bins, where contention is low.
+  atomic
+};
+
+namespace detail {
+constexpr std::size_t histogram_privatized_max_bins = 256;
+constexpr std::size_t histogram_scatter_view_max_bins = 16384;
+constexpr std::int64_t histogram_min_chunk_size = 1024;
+// Threads of concurrency per team of the privatized strategy on device
+// execution spaces.
+constexpr std::int64_t histogram_team_threads = 256;
+
+inline histogram_strategy
+get_histogram_strategy(histogram_strategy const strategy,
+                       std::size_t const num_bins) {
+  if (strategy != histogram_strategy::automatic) {
+    return strategy;
+  } else if (num_bins <= histogram_privatized_max_bins) {
+    return histogram_strategy::privatized;
+  } else if (num_bins <= histogram_scatter_view_max_bins) {
+    return histogram_strategy::scatter_view;
+  } else {
+    return histogram_strategy::atomic;
+  }
+}
+
+template <typename Source, typename KeyFn>
+KOKKOS_INLINE_FUNCTION std::int64_t
+histogram_key(Source const &source, KeyFn const &key_fn, std::int64_t const i) {
+  return static_cast<std::int64_t>(hpx::invoke(key_fn, source(i)));
+}
+
+template <typename ExecutionSpace, typename Source, typename ScatterView,
+          typename KeyFn>
+void histogram_scatter_view_kernel(char const *label,
+                                   ExecutionSpace const &instance,
+                                   Source const &source,
+                                   ScatterView const &scatter_bins,
+                                   std::int64_t const num_bins,
+                                   KeyFn const &key_fn) {
+  Kokkos::parallel_for(
+      label, Kokkos::RangePolicy<ExecutionSpace>(instance, 0, source.size()),
+      KOKKOS_LAMBDA(std::int64_t const i) {
+        std::int64_t const b = histogram_key(source, key_fn, i);
+        if (b >= 0 && b < num_bins) {
+          auto access = scatter_bins.access();
+          access(b) += 1;
+        }
+      });
+  count_kernel_launch<ExecutionSpace>();
+}
+
+template <typename ExecutionSpace, typename Source, typename Bins,
+          typename KeyFn>
+hpx::shared_future<void>
+histogram_scatter_view(char const *label, ExecutionSpace const &instance,
+                       Source const &source, Bins const &bins,
+                       KeyFn const &key_fn) {
+  using scatter_view_type =
+      Kokkos::Experimental::ScatterView<typename Bins::non_const_data_type,
+                                        typename Bins::array_layout,
+                                        ExecutionSpace>;
+
+  std::int64_t const num_bins = bins.extent(0);
+
+#if KOKKOS_VERSION >= 30700
+  // The constructor resets the duplicated bins with reset(instance).
+  scatter_view_type scatter_bins(instance, bins);
+  histogram_scatter_view_kernel(label, instance, source, scatter_bins,
+                                num_bins, key_fn);
+  Kokkos::Experimental::contribute(instance, bins, scatter_bins);
+
+  return get_future<ExecutionSpace>::call(instance).then(
+      hpx::launch::sync,
+      [scatter_bins](hpx::shared_future<void> &&f) { f.get(); });
+#else
+  // Older Kokkos versions only reset and contribute on the default instance.
+  // The kernel on instance is ordered with them through futures instead of
+  // fences.
+  scatter_view_type scatter_bins(bins);
+  std::string const kernel_label(label);
+
+  return get_future<ExecutionSpace>::call(ExecutionSpace{})
+      .then(hpx::launch::sync,
+            [=](hpx::shared_future<void> &&f) {
+              f.get();
+              histogram_scatter_view_kernel(kernel_label.c_str(), instance,
+                                            source, scatter_bins, num_bins,
+                                            key_fn);
+              return get_future<ExecutionSpace>::call(instance);
+            })
+      .then(hpx::launch::sync,
+            [bins, scatter_bins](auto &&f) {
+              f.get();
+              Kokkos::Experimental::contribute(bins, scatter_bins);
+              return get_future<ExecutionSpace>::call(ExecutionSpace{});
+            })
+      .then(hpx::launch::sync,
+            [scatter_bins](auto &&f) { f.get(); });
+#endif
+}
+
+// Host execution spaces: each chunk owns one row of private bins, taken from
+// the scratch arena of the instance, so no atomics are needed. The rows are
+// merged in a second kernel.
+template <typename ExecutionSpace, typename Source, typename Bins,
+          typename KeyFn>
+hpx::shared_future<void>
+histogram_privatized_chunks(char const *label, ExecutionSpace const &instance,
+                            Source const &source, Bins const &bins,
+                            KeyFn const &key_fn) {
+  using count_type = typename Bins::non_const_value_type;
+  using memory_space = typename ExecutionSpace::memory_space;
+
+  std::int64_t const n = source.size();
+  std::int64_t const num_bins = bins.extent(0);
+  std::int64_t const num_chunks = (std::max)(
+      std::int64_t(1),
+      (std::min)(std::int64_t(instance.concurrency()),
+                 n / histogram_min_chunk_size));
+  std::int64_t const chunk_size = (n + num_chunks - 1) / num_chunks;
+
+  auto lease = get_scratch_arena<memory_space>(instance).acquire();
+  auto const private_bins =
+      lease.template allocate<count_type>(num_chunks * num_bins);
+
+  Kokkos::parallel_for(
+      label, Kokkos::RangePolicy<ExecutionSpace>(instance, 0, num_chunks),
+      KOKKOS_LAMBDA(std::int64_t const c) {
+        count_type *const row = &private_bins(c * num_bins);
+        for (std::int64_t b = 0; b < num_bins; ++b) {
+          row[b] = 0;
+        }
+        std::int64_t const end = (std::min)(n, (c + 1) * chunk_size);
+        for (std::int64_t i = c * chunk_size; i < end; ++i) {
+          std::int64_t const b = histogram_key(source, key_fn, i);
+          if (b >= 0 && b < num_bins) {
+            ++row[b];
+          }
+        }
+      });
+  count_kernel_launch<ExecutionSpace>();
+
+  // Kernels on the same instance are executed in order.
+  return keep_alive(
+      parallel_for_async(
+          label, Kokkos::RangePolicy<ExecutionSpace>(instance, 0, num_bins),
+          KOKKOS_LAMBDA(std::int64_t const b) {
+            count_type sum = 0;
+            for (std::int64_t c = 0; c < num_chunks; ++c) {
+              sum += private_bins(c * num_bins + b);
+            }
+            bins(b) += sum;
+          }),
+      std::move(lease));
+}
+
+// Device execution spaces: each team accumulates into bins in team scratch
+// memory, reading the input with consecutive threads on consecutive
+// elements, and adds its bins to the result with atomics. The number of
+// teams is bounded by the concurrency of the instance. Falls back to the
+// scatter_view strategy if the bins do not fit into team scratch memory.
+template <typename ExecutionSpace, typename Source, typename Bins,
+          typename KeyFn>
+hpx::shared_future<void>
+histogram_privatized_teams(char const *label, ExecutionSpace const &instance,
+                           Source const &source, Bins const &bins,
+                           KeyFn const &key_fn) {
+  using count_type = typename Bins::non_const_value_type;
+  using policy_type = Kokkos::TeamPolicy<ExecutionSpace>;
+  using team_member_type = typename policy_type::member_type;
+  using team_bins_type =
+      Kokkos::View<count_type *,
+                   typename ExecutionSpace::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  std::int64_t const n = source.size();
+  std::int64_t const num_bins = bins.extent(0);
+  std::size_t const scratch_size = team_bins_type::shmem_size(num_bins);
+
+  if (scratch_size > std::size_t(policy_type::scratch_size_max(0))) {
+    return histogram_scatter_view(label, instance, source, bins, key_fn);
+  }
+
+  std::int64_t const num_teams = (std::max)(
+      std::int64_t(1),
+      (std::min)(std::int64_t(instance.concurrency()) /
+                     histogram_team_threads,
+                 n / histogram_min_chunk_size));
+  std::int64_t const chunk_size = (n + num_teams - 1) / num_teams;
+
+  return parallel_for_async(
+      label,
+      policy_type(instance, num_teams, Kokkos::AUTO)
+          .set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
+      KOKKOS_LAMBDA(team_member_type const &member) {
+        team_bins_type team_bins(member.team_scratch(0), num_bins);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member, num_bins),
+                             [&](std::int64_t const b) { team_bins(b) = 0; });
+        member.team_barrier();
+
+        std::int64_t const begin = member.league_rank() * chunk_size;
+        std::int64_t const end = (std::min)(n, begin + chunk_size);
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(member, begin, end),
+            [&](std::int64_t const i) {
+              std::int64_t const b = histogram_key(source, key_fn, i);
+              if (b >= 0 && b < num_bins) {
+                Kokkos::atomic_increment(&team_bins(b));
+              }
+            });
+        member.team_barrier();
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member, num_bins),
+                             [&](std::int64_t const b) {
+                               if (team_bins(b) != 0) {
+                                 Kokkos::atomic_add(&bins(b), team_bins(b));
+                               }
+                             });
+      });
+}
+
+template <typename ExecutionSpace, typename Source, typename Bins,
+          typename KeyFn>
+hpx::shared_future<void>
+histogram_privatized(char const *label, ExecutionSpace const &instance,
+                     Source const &source, Bins const &bins,
+                     KeyFn const &key_fn) {
+  if constexpr (Kokkos::SpaceAccessibility<
+                    Kokkos::HostSpace,
+                    typename ExecutionSpace::memory_space>::accessible) {
+    return histogram_privatized_chunks(label, instance, source, bins, key_fn);
+  } else {
+    return histogram_privatized_teams(label, instance, source, bins, key_fn);
+  }
+}
+
+template <typename ExecutionSpace, typename Source, typename Bins,
+          typename KeyFn>
+hpx::shared_future<void>
+histogram_atomic(char const *label, ExecutionSpace const &instance,
+                 Source const &source, Bins const &bins, KeyFn const &key_fn) {
+  std::int64_t const num_bins = bins.extent(0);
+
+  return parallel_for_async(
+      label, Kokkos::RangePolicy<ExecutionSpace>(instance, 0, source.size()),
+      KOKKOS_LAMBDA(std::int64_t const i) {
+        std::int64_t const b = histogram_key(source, key_fn, i);
+        if (b >= 0 && b < num_bins) {
+          Kokkos::atomic_increment(&bins(b));
+        }
+      });
+}
+} // namespace detail
+
+/// \brief Counts the elements of range into bins. key_fn is called with each
+/// element and returns the index of the bin to increment. Elements with an
+/// index outside [0, bins.extent(0)) are ignored. The counts are added to
+/// the existing values of bins. The range can be a rank 1 Kokkos::View, a
+/// view_range of any rank, a Kokkos::RangePolicy (in which case the elements
+/// are the indices), or a range with random access iterators. The range and
+/// bins must be accessible from the execution space of the policy. By
+/// default the strategy is chosen based on the number of bins (see
+/// histogram_strategy). Returns a future that becomes ready when the bins
+/// have been updated.
+template <typename ExecutionPolicy, typename Range, typename Bins,
+          typename KeyFn,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+hpx::shared_future<void>
+histogram_async(ExecutionPolicy &&policy, Range &&range, Bins const &bins,
+                KeyFn &&key_fn,
+                histogram_strategy const strategy =
+                    histogram_strategy::automatic) {
+  static_assert(Kokkos::is_view<Bins>::value && Bins::rank == 1,
+                "hpx::kokkos::histogram_async requires bins to be a view of "
+                "rank 1");
+  static_assert(std::is_integral<typename Bins::value_type>::value,
+                "hpx::kokkos::histogram_async requires integral bins");
+  static_assert(
+      detail::is_single_instance<decltype(policy.executor().instance())>::value,
+      "hpx::kokkos::histogram_async requires an executor with a single "
+      "execution space instance");
+
+  auto const source = detail::make_pipeline_source(std::forward<Range>(range));
+  auto const &instance = policy.executor().instance();
+  typename std::decay<KeyFn>::type const f(std::forward<KeyFn>(key_fn));
+
+  if (source.size() == 0) {
+    return hpx::make_ready_future();
+  }
+
+  switch (detail::get_histogram_strategy(strategy, bins.extent(0))) {
+  case histogram_strategy::privatized:
+    return detail::histogram_privatized(policy.label(), instance, source, bins,
+                                        f);
+  case histogram_strategy::scatter_view:
+    return detail::histogram_scatter_view(policy.label(), instance, source,
+                                          bins, f);
+  default:
+    return detail::histogram_atomic(policy.label(), instance, source, bins, f);
+  }
+}
+} // namespace kokkos
+} // namespace hpx
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <hpx/kokkos/hpx_algorithms_by_key.hpp>
+#include <hpx/kokkos/hpx_algorithms_compaction.hpp>
 #include <hpx/kokkos/hpx_algorithms_for_each.hpp>
 #include <hpx/kokkos/hpx_algorithms_for_loop.hpp>
 #include <hpx/kokkos/hpx_algorithms_reduce.hpp>
@@ -0,0 +1,262 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file Contains segmented algorithms over sorted keys (reduce_by_key,
+/// inclusive_scan_by_key) for the Kokkos execution policy. Segments are runs
+/// of consecutive equal keys. Both algorithms are implemented with a single
+/// Kokkos::parallel_scan over a (value, segment count) pair: head flags,
+/// segmented scan, and the scatter of the results are all done in one kernel,
+/// without synchronizing with the host in between.
+
+#pragma once
+
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/hpx_algorithms_compaction.hpp>
+#include <hpx/kokkos/hpx_algorithms_reduce.hpp>
+#include <hpx/kokkos/kokkos_algorithms.hpp>
+#include <hpx/kokkos/policy.hpp>
+#include <hpx/kokkos/view.hpp>
+
+#include <hpx/functional.hpp>
+#include <hpx/future.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+namespace kokkos {
+namespace detail {
+// Value type of the segmented scan. heads is the number of segment heads
+// seen, value is the scan of the values since the last head. The valid flag is
+// used in place of an identity element, which does not exist for arbitrary
+// binary operations.
+template <typename T> struct segmented_scan_value {
+  T value;
+  std::int64_t heads;
+  bool valid;
+};
+
+// Computes the segmented inclusive scan of values over [0, n), where segments
+// are determined by comp applied to consecutive keys. In the final pass,
+// write(i, v, last) is called with the inclusive scan v at i and a flag
+// telling if i is the last element of its segment.
+template <typename KeyIter, typename ValueIter, typename Comp, typename Op,
+          typename Write, typename T>
+struct segmented_scan_functor {
+  using value_type = segmented_scan_value<T>;
+
+  KeyIter keys;
+  ValueIter values;
+  Comp comp;
+  Op op;
+  Write write;
+  std::int64_t n;
+
+  KOKKOS_INLINE_FUNCTION bool is_head(std::int64_t const i) const {
+    return i == 0 || !bool(hpx::invoke(comp, kernel_element(keys, i - 1),
+                                       kernel_element(keys, i)));
+  }
+
+  // dest holds the earlier part of the range, src the later part. Kokkos
+  // always joins the partial results of a scan in this order, also across
+  // threads and teams. The join is associative but not commutative: the
+  // value of src replaces the value of dest if src contains a segment head,
+  // and is combined with it otherwise. The number of heads acts as the
+  // segment flag of the combined part.
+  KOKKOS_INLINE_FUNCTION void join(value_type &dest,
+                                   value_type const &src) const {
+    if (!src.valid) {
+      return;
+    } else if (!dest.valid || src.heads > 0) {
+      dest.value = src.value;
+    } else {
+      dest.value = hpx::invoke(op, dest.value, src.value);
+    }
+    dest.heads += src.heads;
+    dest.valid = true;
+  }
+
+#if KOKKOS_VERSION < 30700
+  // Kokkos versions before 3.7 require volatile join overloads.
+  KOKKOS_INLINE_FUNCTION void join(volatile value_type &dest,
+                                   volatile value_type const &src) const {
+    if (!src.valid) {
+      return;
+    } else if (!dest.valid || src.heads > 0) {
+      dest.value = src.value;
+    } else {
+      dest.value = hpx::invoke(op, T(dest.value), T(src.value));
+    }
+    dest.heads += src.heads;
+    dest.valid = true;
+  }
+#endif
+
+  KOKKOS_INLINE_FUNCTION void init(value_type &v) const {
+    v.heads = 0;
+    v.valid = false;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(std::int64_t const i,
+                                         value_type &update,
+                                         bool const final) const {
+    join(update,
+         value_type{kernel_element(values, i), is_head(i) ? 1 : 0, true});
+    if (final) {
+      write(i, update, i == n - 1 || is_head(i + 1));
+    }
+  }
+};
+
+template <typename ExecutionSpace, typename KeyIter, typename ValueIter,
+          typename Comp, typename Op, typename Write>
+hpx::shared_future<void>
+segmented_scan_helper(char const *label, ExecutionSpace &&instance,
+                      KeyIter keys, ValueIter values, std::int64_t const n,
+                      Comp const &comp, Op const &op, Write const &write) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+  using value_type = typename std::iterator_traits<ValueIter>::value_type;
+
+  if (n == 0) {
+    return hpx::make_ready_future();
+  }
+
+  auto keys_in = make_kernel_range<execution_space>(keys, n);
+  auto values_in = make_kernel_range<execution_space>(values, n);
+  return parallel_scan_async(
+      label, Kokkos::RangePolicy<execution_space>(instance, 0, n),
+      segmented_scan_functor<decltype(keys_in), decltype(values_in), Comp, Op,
+                             Write, value_type>{keys_in, values_in, comp, op,
+                                                write, n});
+}
+
+template <typename ExecutionSpace, typename KeyIter, typename ValueIter,
+          typename KeyOutIter, typename ValueOutIter, typename Comp,
+          typename Op>
+hpx::shared_future<std::pair<KeyOutIter, ValueOutIter>>
+reduce_by_key_helper(char const *label, ExecutionSpace &&instance,
+                     KeyIter key_first, KeyIter key_last, ValueIter values,
+                     KeyOutIter keys_out, ValueOutIter values_out,
+                     Comp const &comp, Op const &op) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::kokkos::reduce_by_key requires an executor with a "
+                "single execution space instance");
+  using scan_value_type = segmented_scan_value<
+      typename std::iterator_traits<ValueIter>::value_type>;
+
+  std::int64_t const n = std::distance(key_first, key_last);
+  if (n == 0) {
+    return hpx::make_ready_future(std::make_pair(keys_out, values_out));
+  }
+
+  // The number of segments is written by the kernel to host-accessible memory
+  // so that only the count is read on the host.
+  auto lease = acquire_reduce_result_lease(instance);
+  auto count = lease.template allocate<std::int64_t>();
+  auto const keys_in = make_kernel_range<ExecutionSpace>(key_first, n);
+
+  auto write = KOKKOS_LAMBDA(std::int64_t const i, scan_value_type const &v,
+                             bool const last) {
+    if (last) {
+      *(keys_out + (v.heads - 1)) = kernel_element(keys_in, i);
+      *(values_out + (v.heads - 1)) = v.value;
+      if (i == n - 1) {
+        count() = v.heads;
+      }
+    }
+  };
+
+  return segmented_scan_helper(label, std::forward<ExecutionSpace>(instance),
+                               key_first, values, n, comp, op, write)
+      .then(hpx::launch::sync,
+            [count, lease, keys_out,
+             values_out](hpx::shared_future<void> &&) mutable {
+              std::int64_t const value = count();
+              lease.release();
+              return std::make_pair(keys_out + value, values_out + value);
+            });
+}
+
+template <typename ExecutionSpace, typename KeyIter, typename ValueIter,
+          typename OutIter, typename Comp, typename Op>
+hpx::shared_future<OutIter> inclusive_scan_by_key_helper(
+    char const *label, ExecutionSpace &&instance, KeyIter key_first,
+    KeyIter key_last, ValueIter values, OutIter dest, Comp const &comp,
+    Op const &op) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::kokkos::inclusive_scan_by_key requires an executor "
+                "with a single execution space instance");
+  using scan_value_type = segmented_scan_value<
+      typename std::iterator_traits<ValueIter>::value_type>;
+
+  std::int64_t const n = std::distance(key_first, key_last);
+
+  auto write =
+      KOKKOS_LAMBDA(std::int64_t const i, scan_value_type const &v, bool) {
+    *(dest + i) = v.value;
+  };
+
+  return segmented_scan_helper(label, std::forward<ExecutionSpace>(instance),
+                               key_first, values, n, comp, op, write)
+      .then(hpx::launch::sync,
+            [dest, n](hpx::shared_future<void> &&) { return dest + n; });
+}
+
+struct plus {
+  template <typename T, typename U>
+  KOKKOS_INLINE_FUNCTION auto operator()(T const &x, U const &y) const {
+    return x + y;
+  }
+};
+} // namespace detail
+
+/// \brief Reduces runs of consecutive equal keys in [key_first, key_last)
+/// and the corresponding values starting at values_first. For each run, the
+/// key is written to keys_out and the reduction of the values with op is
+/// written to values_out. Keys are compared with comp. Returns the ends of
+/// the two output ranges, or a future to them for task policies. The same as
+/// hpx::experimental::reduce_by_key, but all ranges must be accessible from
+/// the execution space of the policy.
+template <typename ExecutionPolicy, typename KeyIter, typename ValueIter,
+          typename KeyOutIter, typename ValueOutIter,
+          typename Comp = detail::equal_to, typename Op = detail::plus,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto reduce_by_key(ExecutionPolicy &&policy, KeyIter key_first,
+                   KeyIter key_last, ValueIter values_first,
+                   KeyOutIter keys_out, ValueOutIter values_out,
+                   Comp &&comp = Comp(), Op &&op = Op()) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::reduce_by_key_helper(policy.label(),
+                                   policy.executor().instance(), key_first,
+                                   key_last, values_first, keys_out,
+                                   values_out, std::forward<Comp>(comp),
+                                   std::forward<Op>(op)));
+}
+
+/// \brief Computes the inclusive scan of the values starting at values_first
+/// with op, restarting at each run of consecutive equal keys in [key_first,
+/// key_last). Keys are compared with comp. Returns the end of the output
+/// range, or a future to it for task policies.
+template <typename ExecutionPolicy, typename KeyIter, typename ValueIter,
+          typename OutIter, typename Comp = detail::equal_to,
+          typename Op = detail::plus,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto inclusive_scan_by_key(ExecutionPolicy &&policy, KeyIter key_first,
+                           KeyIter key_last, ValueIter values_first,
+                           OutIter dest, Comp &&comp = Comp(),
+                           Op &&op = Op()) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::inclusive_scan_by_key_helper(
+          policy.label(), policy.executor().instance(), key_first, key_last,
+          values_first, dest, std::forward<Comp>(comp), std::forward<Op>(op)));
+}
+} // namespace kokkos
+} // namespace hpx
@@ -0,0 +1,255 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file Contains specializations of HPX stream compaction algorithms
+/// (copy_if, remove_copy_if, partition_copy, unique_copy) for the Kokkos
+/// execution policy. The algorithms are implemented with a single
+/// Kokkos::parallel_scan: the scan computes the output position of each
+/// selected element, and the final pass of the scan writes the element. The
+/// number of selected elements is written by the kernel to host-accessible
+/// memory, so that the data itself is never touched by the host.
+
+#pragma once
+
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/hpx_algorithms_reduce.hpp>
+#include <hpx/kokkos/kokkos_algorithms.hpp>
+#include <hpx/kokkos/policy.hpp>
+#include <hpx/kokkos/view.hpp>
+
+#include <hpx/algorithm.hpp>
+#include <hpx/functional.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+namespace kokkos {
+namespace detail {
+template <typename Flag, typename Write, typename CountView>
+struct compaction_scan_functor {
+  using value_type = std::int64_t;
+
+  Flag flag;
+  Write write;
+  std::int64_t n;
+  CountView count;
+
+  KOKKOS_INLINE_FUNCTION void operator()(std::int64_t const i,
+                                         value_type &update,
+                                         bool const final) const {
+    bool const keep = flag(i);
+    if (final) {
+      write(i, update, keep);
+      if (i == n - 1) {
+        count() = update + keep;
+      }
+    }
+    update += keep;
+  }
+};
+
+// Launches a compaction scan over [0, n). flag(i) determines if element i is
+// selected, and write(i, position, selected) is called in the final pass with
+// the number of selected elements before i. Returns a future to the number of
+// selected elements.
+template <typename ExecutionSpace, typename Flag, typename Write>
+hpx::shared_future<std::int64_t>
+compaction_helper(char const *label, ExecutionSpace &&instance,
+                  std::int64_t const n, Flag const &flag, Write const &write) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+
+  if (n == 0) {
+    return hpx::make_ready_future(std::int64_t(0));
+  }
+
+  auto lease = acquire_reduce_result_lease(instance);
+  auto count = lease.template allocate<std::int64_t>();
+
+  return parallel_scan_async(
+             label,
+             Kokkos::RangePolicy<execution_space>(instance, 0, n),
+             compaction_scan_functor<Flag, Write, decltype(count)>{
+                 flag, write, n, count})
+      .then(hpx::launch::sync,
+            [count, lease](hpx::shared_future<void> &&) mutable {
+              std::int64_t const value = count();
+              lease.release();
+              return value;
+            });
+}
+
+template <typename ExecutionSpace, typename IterB, typename IterE,
+          typename OutIter, typename Pred>
+hpx::shared_future<OutIter> copy_if_helper(char const *label,
+                                           ExecutionSpace &&instance,
+                                           IterB first, IterE last,
+                                           OutIter dest, Pred &&pred) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::copy_if requires an executor with a single execution "
+                "space instance");
+  std::int64_t const n = std::distance(first, last);
+  auto const in = make_kernel_range<ExecutionSpace>(first, n);
+  auto flag = KOKKOS_LAMBDA(std::int64_t const i) {
+    return bool(hpx::invoke(pred, kernel_element(in, i)));
+  };
+  auto write = KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const pos,
+                             bool const keep) {
+    if (keep) {
+      *(dest + pos) = kernel_element(in, i);
+    }
+  };
+
+  return compaction_helper(label, std::forward<ExecutionSpace>(instance), n,
+                           flag, write)
+      .then(hpx::launch::sync, [dest](hpx::shared_future<std::int64_t> &&f) {
+        return dest + f.get();
+      });
+}
+
+template <typename ExecutionSpace, typename IterB, typename IterE,
+          typename OutIter1, typename OutIter2, typename Pred>
+hpx::shared_future<std::pair<OutIter1, OutIter2>>
+partition_copy_helper(char const *label, ExecutionSpace &&instance,
+                      IterB first, IterE last, OutIter1 dest_true,
+                      OutIter2 dest_false, Pred &&pred) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::partition_copy requires an executor with a single "
+                "execution space instance");
+  std::int64_t const n = std::distance(first, last);
+  auto const in = make_kernel_range<ExecutionSpace>(first, n);
+  auto flag = KOKKOS_LAMBDA(std::int64_t const i) {
+    return bool(hpx::invoke(pred, kernel_element(in, i)));
+  };
+  auto write = KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const pos,
+                             bool const keep) {
+    if (keep) {
+      *(dest_true + pos) = kernel_element(in, i);
+    } else {
+      *(dest_false + (i - pos)) = kernel_element(in, i);
+    }
+  };
+
+  return compaction_helper(label, std::forward<ExecutionSpace>(instance), n,
+                           flag, write)
+      .then(hpx::launch::sync, [n, dest_true, dest_false](
+                                   hpx::shared_future<std::int64_t> &&f) {
+        auto const count = f.get();
+        return std::make_pair(dest_true + count, dest_false + (n - count));
+      });
+}
+
+template <typename ExecutionSpace, typename IterB, typename IterE,
+          typename OutIter, typename Pred>
+hpx::shared_future<OutIter> unique_copy_helper(char const *label,
+                                               ExecutionSpace &&instance,
+                                               IterB first, IterE last,
+                                               OutIter dest, Pred &&pred) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::unique_copy requires an executor with a single "
+                "execution space instance");
+  std::int64_t const n = std::distance(first, last);
+  auto const in = make_kernel_range<ExecutionSpace>(first, n);
+  auto flag = KOKKOS_LAMBDA(std::int64_t const i) {
+    return i == 0 || !bool(hpx::invoke(pred, kernel_element(in, i - 1),
+                                       kernel_element(in, i)));
+  };
+  auto write = KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const pos,
+                             bool const keep) {
+    if (keep) {
+      *(dest + pos) = kernel_element(in, i);
+    }
+  };
+
+  return compaction_helper(label, std::forward<ExecutionSpace>(instance), n,
+                           flag, write)
+      .then(hpx::launch::sync, [dest](hpx::shared_future<std::int64_t> &&f) {
+        return dest + f.get();
+      });
+}
+
+template <typename Pred> struct not_pred {
+  Pred pred;
+
+  template <typename T> KOKKOS_INLINE_FUNCTION bool operator()(T &&x) const {
+    return !bool(hpx::invoke(pred, std::forward<T>(x)));
+  }
+};
+
+struct equal_to {
+  template <typename T, typename U>
+  KOKKOS_INLINE_FUNCTION bool operator()(T const &x, U const &y) const {
+    return x == y;
+  }
+};
+} // namespace detail
+
+// Copy if customization. Returns the end of the output range.
+template <typename ExecutionPolicy, typename Iter, typename OutIter,
+          typename Pred,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto tag_invoke(hpx::copy_if_t, ExecutionPolicy &&policy, Iter first,
+                Iter last, OutIter dest, Pred &&pred) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::copy_if_helper(policy.label(), policy.executor().instance(),
+                             first, last, dest, std::forward<Pred>(pred)));
+}
+
+// Remove copy if customization. Returns the end of the output range.
+template <typename ExecutionPolicy, typename Iter, typename OutIter,
+          typename Pred,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto tag_invoke(hpx::remove_copy_if_t, ExecutionPolicy &&policy, Iter first,
+                Iter last, OutIter dest, Pred &&pred) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::copy_if_helper(
+          policy.label(), policy.executor().instance(), first, last, dest,
+          detail::not_pred<typename std::decay<Pred>::type>{
+              std::forward<Pred>(pred)}));
+}
+
+// Partition copy customization. Returns the ends of the two output ranges.
+template <typename ExecutionPolicy, typename Iter, typename OutIter1,
+          typename OutIter2, typename Pred,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto tag_invoke(hpx::partition_copy_t, ExecutionPolicy &&policy, Iter first,
+                Iter last, OutIter1 dest_true, OutIter2 dest_false,
+                Pred &&pred) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::partition_copy_helper(
+          policy.label(), policy.executor().instance(), first, last, dest_true,
+          dest_false, std::forward<Pred>(pred)));
+}
+
+// Unique copy customizations. Returns the end of the output range.
+template <typename ExecutionPolicy, typename Iter, typename OutIter,
+          typename Pred,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto tag_invoke(hpx::unique_copy_t, ExecutionPolicy &&policy, Iter first,
+                Iter last, OutIter dest, Pred &&pred) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::unique_copy_helper(policy.label(), policy.executor().instance(),
+                                 first, last, dest, std::forward<Pred>(pred)));
+}
+
+template <typename ExecutionPolicy, typename Iter, typename OutIter,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto tag_invoke(hpx::unique_copy_t, ExecutionPolicy &&policy, Iter first,
+                Iter last, OutIter dest) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::unique_copy_helper(policy.label(), policy.executor().instance(),
+                                 first, last, dest, detail::equal_to{}));
+}
+} // namespace kokkos
+} // namespace hpx
@@ -8,15 +8,20 @@
 
 #pragma once
 
+#include <hpx/kokkos/co_executor.hpp>
 #include <hpx/kokkos/detail/logging.hpp>
 #include <hpx/kokkos/policy.hpp>
+#include <hpx/kokkos/view.hpp>
 
 #include <hpx/algorithm.hpp>
 #include <hpx/functional.hpp>
 
 #include <Kokkos_Core.hpp>
 
+#include <cstddef>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx {
 namespace kokkos {
@@ -26,18 +31,65 @@ template <typename ExecutionSpace, typename IterB, typename IterE, typename F>
 hpx::shared_future<void> for_each_helper(char const *label,
                                          ExecutionSpace &&instance, IterB first,
                                          IterE last, F &&f) {
+  std::size_t const n = std::distance(first, last);
+  auto const in = make_kernel_range<ExecutionSpace>(first, n);
   return parallel_for_async(
       label,
       Kokkos::Experimental::require(
-          Kokkos::RangePolicy<ExecutionSpace>(instance, 0,
-                                              std::distance(first, last)),
+          Kokkos::RangePolicy<ExecutionSpace>(instance, 0, n),
           Kokkos::Experimental::WorkItemProperty::HintLightWeight),
       KOKKOS_LAMBDA(int const i) {
-        HPX_KOKKOS_DETAIL_LOG("for_each i = %d", i);
-        hpx::invoke(f, *(first + i));
+        hpx::invoke(f, kernel_element(in, i));
       });
 }
 
+// Splits the range into one segment per instance.
+template <typename ExecutionSpace, typename IterB, typename IterE, typename F>
+hpx::shared_future<void>
+for_each_helper(char const *label, instance_set<ExecutionSpace> &&instances,
+                IterB first, IterE last, F &&f) {
+  std::size_t const n = std::distance(first, last);
+  std::vector<hpx::shared_future<void>> futures;
+  futures.reserve(instances.size());
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    auto const bounds = get_segment_bounds(n, instances.size(), i);
+    if (bounds.first == bounds.second) {
+      continue;
+    }
+
+    futures.push_back(for_each_helper(label, ExecutionSpace(instances[i]),
+                                      first + bounds.first,
+                                      first + bounds.second, f));
+  }
+
+  return when_all_segments(std::move(futures));
+}
+
+// Splits the range between the host and device instances.
+template <typename HostExecutionSpace, typename DeviceExecutionSpace,
+          typename IterB, typename IterE, typename F>
+hpx::shared_future<void>
+for_each_helper(
+    char const *label,
+    co_instances<HostExecutionSpace, DeviceExecutionSpace> &&instances,
+    IterB first, IterE last, F &&f) {
+  auto futures = instances.co_execute(
+      std::distance(first, last),
+      [&](std::size_t const b, std::size_t const e) {
+        return for_each_helper(label,
+                               HostExecutionSpace(instances.host_instance()),
+                               first + b, first + e, f);
+      },
+      [&](std::size_t const b, std::size_t const e) {
+        return for_each_helper(
+            label, DeviceExecutionSpace(instances.device_instance()),
+            first + b, first + e, f);
+      });
+
+  return when_all_segments(
+      {std::move(futures.first), std::move(futures.second)});
+}
+
 template <typename ExecutionSpace, typename F, typename... Args>
 hpx::shared_future<void>
 for_each_kokkos_policy_helper(char const *label, ExecutionSpace &&instance,
@@ -68,17 +120,100 @@ for_each_kokkos_policy_helper(char const *label, ExecutionSpace &&instance,
       std::forward<F>(f));
 }
 
+template <typename ExecutionSpace, typename Policy, typename... Args>
+struct team_policy_on_space_impl;
+
+template <typename ExecutionSpace, typename... Kept>
+struct team_policy_on_space_impl<ExecutionSpace, Kokkos::TeamPolicy<Kept...>> {
+  using type = Kokkos::TeamPolicy<ExecutionSpace, Kept...>;
+};
+
+template <typename ExecutionSpace, typename... Kept, typename Arg,
+          typename... Args>
+struct team_policy_on_space_impl<ExecutionSpace, Kokkos::TeamPolicy<Kept...>,
+                                 Arg, Args...>
+    : team_policy_on_space_impl<
+          ExecutionSpace,
+          typename std::conditional<Kokkos::is_execution_space<Arg>::value,
+                                    Kokkos::TeamPolicy<Kept...>,
+                                    Kokkos::TeamPolicy<Kept..., Arg>>::type,
+          Args...> {};
+
+// The type of a team policy with the template arguments Args (e.g. a work
+// tag, schedule, or index type) on ExecutionSpace instead of the execution
+// space given in Args, if any.
+template <typename ExecutionSpace, typename... Args>
+using team_policy_on_space_t =
+    typename team_policy_on_space_impl<ExecutionSpace, Kokkos::TeamPolicy<>,
+                                       Args...>::type;
+
+template <typename ExecutionSpace, typename... Args>
+team_policy_on_space_t<typename std::decay<ExecutionSpace>::type, Args...>
+make_team_policy_on_instance(ExecutionSpace &&instance,
+                             Kokkos::TeamPolicy<Args...> const &p) {
+  using policy_type =
+      team_policy_on_space_t<typename std::decay<ExecutionSpace>::type,
+                             Args...>;
+
+  // The team size and vector length are only resolved lazily on some
+  // backends, so AUTO has to be forwarded as AUTO instead of the placeholder
+  // value stored in the user-provided policy.
+  auto q = [&]() {
+    if (p.impl_auto_team_size() && p.impl_auto_vector_length()) {
+      return policy_type(instance, p.league_size(), Kokkos::AUTO,
+                         Kokkos::AUTO);
+    } else if (p.impl_auto_team_size()) {
+      return policy_type(instance, p.league_size(), Kokkos::AUTO,
+                         p.impl_vector_length());
+    } else if (p.impl_auto_vector_length()) {
+      return policy_type(instance, p.league_size(), p.team_size(),
+                         Kokkos::AUTO);
+    } else {
+      return policy_type(instance, p.league_size(), p.team_size(),
+                         p.impl_vector_length());
+    }
+  }();
+
+  for (int level = 0; level < 2; ++level) {
+    q.set_scratch_size(level, Kokkos::PerTeam(p.team_scratch_size(level)),
+                       Kokkos::PerThread(p.thread_scratch_size(level)));
+  }
+  if (p.chunk_size() > 0) {
+    q.set_chunk_size(p.chunk_size());
+  }
+
+  return q;
+}
+
 template <typename ExecutionSpace, typename F, typename... Args>
 hpx::shared_future<void>
 for_each_kokkos_policy_helper(char const *label, ExecutionSpace &&instance,
                               Kokkos::TeamPolicy<Args...> const &p, F &&f) {
-
-  static_assert(
-      sizeof(ExecutionSpace) == 0,
-      "for_each overload cannot currently be used with Kokkos::TeamPolicy");
-  return {};
+  // The functor is called with the team member handle. The template
+  // arguments other than the execution space (e.g. a work tag or schedule),
+  // team and thread scratch sizes, the team size and the vector length of the
+  // given policy are preserved.
+  return parallel_for_async(
+      label,
+      make_team_policy_on_instance(std::forward<ExecutionSpace>(instance), p),
+      std::forward<F>(f));
 }
 
+template <typename View, typename F,
+          typename Indices = std::make_index_sequence<View::rank>>
+struct view_for_each_functor;
+
+// Calls the functor with each element of a view of any rank.
+template <typename View, typename F, std::size_t... Is>
+struct view_for_each_functor<View, F, std::index_sequence<Is...>> {
+  View v;
+  F f;
+
+  KOKKOS_INLINE_FUNCTION void operator()(view_index_t<Is>... is) const {
+    hpx::invoke(f, v(is...));
+  }
+};
+
 template <typename ExecutionSpace, typename Range, typename F,
           typename std::enable_if<Kokkos::is_execution_policy<
                                       typename std::decay<Range>::type>::value,
@@ -86,15 +221,42 @@ template <typename ExecutionSpace, typename Range, typename F,
 hpx::shared_future<void> for_each_range_helper(char const *label,
                                                ExecutionSpace &&instance,
                                                Range &&range, F &&f) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::for_each over a Kokkos execution policy "
+                "requires an executor with a single execution space instance");
   return for_each_kokkos_policy_helper(
       label, std::forward<ExecutionSpace>(instance), std::forward<Range>(range),
       std::forward<F>(f));
 }
 
+// Views and view ranges of rank 2 or higher are launched with a
+// multi-dimensional range policy following the layout of the view.
+template <typename ExecutionSpace, typename Range, typename F,
+          typename std::enable_if<is_view_or_view_range<
+                                      typename std::decay<Range>::type>::value,
+                                  int>::type = 0>
+hpx::shared_future<void> for_each_range_helper(char const *label,
+                                               ExecutionSpace &&instance,
+                                               Range &&range, F &&f) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::for_each over a view requires an executor with "
+                "a single execution space instance");
+  auto const &v = get_view(range);
+  using view_type = typename std::decay<decltype(v)>::type;
+  return parallel_for_async(
+      label,
+      Kokkos::Experimental::require(
+          make_view_policy(instance, v),
+          Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+      view_for_each_functor<view_type, typename std::decay<F>::type>{
+          v, std::forward<F>(f)});
+}
+
 template <
     typename ExecutionSpace, typename Range, typename F,
     typename std::enable_if<
         !Kokkos::is_execution_policy<typename std::decay<Range>::type>::value &&
+            !is_view_or_view_range<typename std::decay<Range>::type>::value &&
             hpx::traits::is_range<Range>::value,
         int>::type = 0>
 hpx::shared_future<void> for_each_range_helper(char const *label,
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <hpx/kokkos/co_executor.hpp>
 #include <hpx/kokkos/detail/logging.hpp>
 #include <hpx/kokkos/policy.hpp>
 
@@ -15,7 +16,10 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <cstddef>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx {
 namespace kokkos {
@@ -32,6 +36,57 @@ for_loop_helper(char const *label, ExecutionSpace &&instance,
       std::forward<F>(f));
 }
 
+// Splits the range into one segment per instance.
+template <typename ExecutionSpace, typename I, typename F,
+          typename Enable = std::enable_if_t<std::is_integral<I>::value>>
+hpx::shared_future<void>
+for_loop_helper(char const *label, instance_set<ExecutionSpace> &&instances,
+                typename std::decay<I>::type first, I last, F &&f) {
+  std::size_t const n = last > first ? last - first : 0;
+  std::vector<hpx::shared_future<void>> futures;
+  futures.reserve(instances.size());
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    auto const bounds = get_segment_bounds(n, instances.size(), i);
+    if (bounds.first == bounds.second) {
+      continue;
+    }
+
+    futures.push_back(
+        for_loop_helper(label, ExecutionSpace(instances[i]),
+                        static_cast<I>(first + bounds.first),
+                        static_cast<I>(first + bounds.second), f));
+  }
+
+  return when_all_segments(std::move(futures));
+}
+
+// Splits the range between the host and device instances.
+template <typename HostExecutionSpace, typename DeviceExecutionSpace,
+          typename I, typename F,
+          typename Enable = std::enable_if_t<std::is_integral<I>::value>>
+hpx::shared_future<void>
+for_loop_helper(
+    char const *label,
+    co_instances<HostExecutionSpace, DeviceExecutionSpace> &&instances,
+    typename std::decay<I>::type first, I last, F &&f) {
+  auto futures = instances.co_execute(
+      last > first ? last - first : 0,
+      [&](std::size_t const b, std::size_t const e) {
+        return for_loop_helper(label,
+                               HostExecutionSpace(instances.host_instance()),
+                               static_cast<I>(first + b),
+                               static_cast<I>(first + e), f);
+      },
+      [&](std::size_t const b, std::size_t const e) {
+        return for_loop_helper(
+            label, DeviceExecutionSpace(instances.device_instance()),
+            static_cast<I>(first + b), static_cast<I>(first + e), f);
+      });
+
+  return when_all_segments(
+      {std::move(futures.first), std::move(futures.second)});
+}
+
 template <typename ExecutionSpace, typename I, std::size_t N, typename F>
 hpx::shared_future<void> for_loop_helper(char const *label,
                                          ExecutionSpace &&instance,
@@ -8,15 +8,24 @@
 
 #pragma once
 
+#include <hpx/kokkos/co_executor.hpp>
 #include <hpx/kokkos/detail/logging.hpp>
 #include <hpx/kokkos/policy.hpp>
+#include <hpx/kokkos/scratch_arena.hpp>
+#include <hpx/kokkos/view.hpp>
 
 #include <hpx/algorithm.hpp>
 #include <hpx/functional.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/tuple.hpp>
 
 #include <Kokkos_Core.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx {
 namespace kokkos {
@@ -56,41 +65,757 @@ template <typename ExecutionSpace>
 using reduce_result_space_t =
     typename reduce_result_space<ExecutionSpace>::type;
 
+// Value type of binary_op_reducer. The valid flag is used in place of an
+// identity element, which does not exist for arbitrary binary operations.
+template <typename T> struct binary_op_reducer_value {
+  T value;
+  bool valid;
+};
+
+// A Kokkos reducer that joins partial results with a user-provided binary
+// operation. This is used instead of the default sum join when reducing with
+// an arbitrary binary operation through hpx::reduce. The result is stored in
+// scratch memory, which must be kept alive with the lease it was allocated
+// from until the result has been read.
+template <typename T, typename F, typename Space> struct binary_op_reducer {
+  using reducer = binary_op_reducer;
+  using value_type = binary_op_reducer_value<T>;
+  using result_view_type =
+      Kokkos::View<value_type, Space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  F f;
+  result_view_type result;
+
+  KOKKOS_INLINE_FUNCTION void join(value_type &dest,
+                                   value_type const &src) const {
+    if (!src.valid) {
+      return;
+    } else if (!dest.valid) {
+      dest.value = src.value;
+      dest.valid = true;
+    } else {
+      dest.value = hpx::invoke(f, dest.value, src.value);
+    }
+  }
+
+#if KOKKOS_VERSION < 30700
+  // Kokkos versions before 3.7 require volatile join overloads.
+  KOKKOS_INLINE_FUNCTION void join(volatile value_type &dest,
+                                   volatile value_type const &src) const {
+    if (!src.valid) {
+      return;
+    } else if (!dest.valid) {
+      dest.value = src.value;
+      dest.valid = true;
+    } else {
+      dest.value = hpx::invoke(f, T(dest.value), T(src.value));
+    }
+  }
+#endif
+
+  KOKKOS_INLINE_FUNCTION void init(value_type &v) const { v.valid = false; }
+
+  KOKKOS_INLINE_FUNCTION value_type &reference() const { return result(); }
+
+  KOKKOS_INLINE_FUNCTION result_view_type view() const { return result; }
+
+  KOKKOS_INLINE_FUNCTION bool references_scalar() const { return false; }
+};
+
+template <typename Reducer, typename V, typename U>
+KOKKOS_INLINE_FUNCTION void reducer_join_element(Reducer const &r, V &update,
+                                                 U const &x) {
+  r.join(update, V(x));
+}
+
+// Elements may have a different type than the result. They are passed to
+// the operation as they are, and only converted to the result type for the
+// first element of a partial result.
+template <typename T, typename F, typename Space, typename U>
+KOKKOS_INLINE_FUNCTION void
+reducer_join_element(binary_op_reducer<T, F, Space> const &r,
+                     binary_op_reducer_value<T> &update, U const &x) {
+  if (update.valid) {
+    update.value = hpx::invoke(r.f, update.value, x);
+  } else {
+    update.value = static_cast<T>(x);
+    update.valid = true;
+  }
+}
+
+template <typename ExecutionSpace>
+scratch_lease<reduce_result_space_t<typename std::decay<ExecutionSpace>::type>>
+acquire_reduce_result_lease(ExecutionSpace const &instance) {
+  return get_scratch_arena<
+             reduce_result_space_t<typename std::decay<ExecutionSpace>::type>>(
+             instance)
+      .acquire();
+}
+
+template <typename T, typename F, typename Space>
+binary_op_reducer<T, typename std::decay<F>::type, Space>
+make_binary_op_reducer(scratch_lease<Space> const &lease, F &&f) {
+  using reducer_type =
+      binary_op_reducer<T, typename std::decay<F>::type, Space>;
+  return reducer_type{
+      std::forward<F>(f),
+      lease.template allocate<typename reducer_type::value_type>()};
+}
+
+template <typename T, typename F, typename Space>
+T binary_op_reducer_result(binary_op_reducer<T, F, Space> const &r, T init,
+                           binary_op_reducer_value<T> const &v) {
+  return v.valid ? hpx::invoke(r.f, init, v.value) : init;
+}
+
+template <typename IterB, typename Reducer> struct iterator_reduce_functor {
+  using value_type = typename Reducer::value_type;
+
+  IterB first;
+  Reducer r;
+
+  KOKKOS_INLINE_FUNCTION void operator()(std::int64_t const i,
+                                         value_type &update) const {
+    reducer_join_element(r, update, kernel_element(first, i));
+  }
+};
+
+template <typename IterB, typename F, typename... Values>
+struct iterator_multi_reduce_functor {
+  IterB first;
+  F f;
+
+  KOKKOS_INLINE_FUNCTION void operator()(std::int64_t const i,
+                                         Values &...updates) const {
+    hpx::invoke(f, kernel_element(first, i), updates...);
+  }
+};
+
+template <typename View, typename Reducer,
+          typename Indices = std::make_index_sequence<View::rank>>
+struct view_reduce_functor;
+
+// Joins the elements of a view of any rank into the reducer.
+template <typename View, typename Reducer, std::size_t... Is>
+struct view_reduce_functor<View, Reducer, std::index_sequence<Is...>> {
+  using value_type = typename Reducer::value_type;
+
+  View v;
+  Reducer r;
+
+  KOKKOS_INLINE_FUNCTION void operator()(view_index_t<Is>... is,
+                                         value_type &update) const {
+    reducer_join_element(r, update, v(is...));
+  }
+};
+
+template <typename View, typename F, typename Indices, typename... Values>
+struct view_multi_reduce_functor;
+
+template <typename View, typename F, std::size_t... Is, typename... Values>
+struct view_multi_reduce_functor<View, F, std::index_sequence<Is...>,
+                                 Values...> {
+  View v;
+  F f;
+
+  KOKKOS_INLINE_FUNCTION void operator()(view_index_t<Is>... is,
+                                         Values &...updates) const {
+    hpx::invoke(f, v(is...), updates...);
+  }
+};
+
+// Reads the result of the reduction into r. The result is copied to the host
+// if the result view of r is not accessible from the host.
+template <typename Reducer>
+typename Reducer::value_type read_reducer_result(Reducer const &r) {
+  using memory_space = typename Reducer::result_view_type::memory_space;
+  if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                           memory_space>::accessible) {
+    return r.reference();
+  } else {
+    typename Reducer::value_type value;
+    Kokkos::deep_copy(value, r.view());
+    return value;
+  }
+}
+
+// Returns a future to the result of the reduction into r. keep_alive (e.g.
+// the scratch lease of the result) is released after the result has been
+// read.
+template <typename Policy, typename Functor, typename Reducer,
+          typename... KeepAlive>
+hpx::shared_future<typename Reducer::value_type>
+reduce_with_reducer(char const *label, Policy const &p, Functor &&f,
+                    Reducer const &r, KeepAlive const &...keep_alive) {
+  return parallel_reduce_async(
+             label,
+             Kokkos::Experimental::require(
+                 p, Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+             std::forward<Functor>(f), r)
+      .then(hpx::launch::sync,
+            [r, keep_alive...](hpx::shared_future<void> &&) mutable {
+              auto const result = read_reducer_result(r);
+              (keep_alive.release(), ...);
+              return result;
+            });
+}
+
+template <typename Policy, typename Functor, typename... Reducers>
+hpx::shared_future<hpx::tuple<typename Reducers::value_type...>>
+reduce_with_reducers(char const *label, Policy const &p, Functor &&f,
+                     Reducers const &...rs) {
+  return parallel_reduce_async(
+             label,
+             Kokkos::Experimental::require(
+                 p, Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+             std::forward<Functor>(f), rs...)
+      .then(hpx::launch::sync, [rs...](hpx::shared_future<void> &&) {
+        return hpx::make_tuple(read_reducer_result(rs)...);
+      });
+}
+
+template <typename ExecutionSpace, typename... Args>
+Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>
+make_policy_on_instance(ExecutionSpace &&instance,
+                        Kokkos::RangePolicy<Args...> const &p) {
+  return Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>(
+      std::forward<ExecutionSpace>(instance), p.begin(), p.end());
+}
+
+template <typename ExecutionSpace, typename... Args>
+Kokkos::MDRangePolicy<
+    typename std::decay<ExecutionSpace>::type,
+    typename Kokkos::MDRangePolicy<Args...>::iteration_pattern>
+make_policy_on_instance(ExecutionSpace &&instance,
+                        Kokkos::MDRangePolicy<Args...> const &p) {
+  return Kokkos::MDRangePolicy<
+      typename std::decay<ExecutionSpace>::type,
+      typename Kokkos::MDRangePolicy<Args...>::iteration_pattern>(
+      std::forward<ExecutionSpace>(instance), p.m_lower, p.m_upper, p.m_tile);
+}
+
 template <typename ExecutionSpace, typename IterB, typename IterE, typename T,
           typename F>
 hpx::shared_future<T> reduce_helper(char const *label,
                                     ExecutionSpace &&instance, IterB first,
                                     IterE last, T init, F &&f) {
-  Kokkos::View<T,
-               reduce_result_space_t<typename std::decay<ExecutionSpace>::type>>
-      result(Kokkos::view_alloc(Kokkos::WithoutInitializing, "reduce_result"));
+  std::size_t const n = std::distance(first, last);
+  auto in = make_kernel_range<ExecutionSpace>(first, n);
+  auto lease = acquire_reduce_result_lease(instance);
+  auto r = make_binary_op_reducer<T>(lease, std::forward<F>(f));
+
+  return reduce_with_reducer(
+             label,
+             Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>(
+                 instance, 0, n),
+             iterator_reduce_functor<decltype(in), decltype(r)>{in, r}, r,
+             lease)
+      .then(hpx::launch::sync, [r, init](auto &&v) {
+        return binary_op_reducer_result(r, init, v.get());
+      });
+}
+
+// Splits the range into one segment per instance. The partial results of the
+// segments are combined on the host.
+template <typename ExecutionSpace, typename IterB, typename IterE, typename T,
+          typename F>
+hpx::shared_future<T> reduce_helper(char const *label,
+                                    instance_set<ExecutionSpace> &&instances,
+                                    IterB first, IterE last, T init, F &&f) {
+  using value_type = binary_op_reducer_value<T>;
+
+  std::size_t const n = std::distance(first, last);
+  auto in = make_kernel_range<ExecutionSpace>(first, n);
+  std::vector<hpx::shared_future<value_type>> futures;
+  futures.reserve(instances.size());
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    auto const bounds = get_segment_bounds(n, instances.size(), i);
+    if (bounds.first == bounds.second) {
+      continue;
+    }
+
+    auto lease = acquire_reduce_result_lease(instances[i]);
+    auto r = make_binary_op_reducer<T>(lease, f);
+    futures.push_back(reduce_with_reducer(
+        label,
+        Kokkos::RangePolicy<ExecutionSpace>(instances[i], bounds.first,
+                                            bounds.second),
+        iterator_reduce_functor<decltype(in), decltype(r)>{in, r}, r, lease));
+  }
+
+  return hpx::when_all(std::move(futures))
+      .then(hpx::launch::sync,
+            [f, init](hpx::future<std::vector<hpx::shared_future<value_type>>>
+                          &&fs) {
+              T result = init;
+              for (auto &fut : fs.get()) {
+                auto const &v = fut.get();
+                if (v.valid) {
+                  result = hpx::invoke(f, result, v.value);
+                }
+              }
+              return result;
+            });
+}
+
+// Splits the range between the host and device instances. The partial
+// results of both sides are combined on the host.
+template <typename HostExecutionSpace, typename DeviceExecutionSpace,
+          typename IterB, typename IterE, typename T, typename F>
+hpx::shared_future<T> reduce_helper(
+    char const *label,
+    co_instances<HostExecutionSpace, DeviceExecutionSpace> &&instances,
+    IterB first, IterE last, T init, F &&f) {
+  std::size_t const n = std::distance(first, last);
+  auto launch = [&](auto const &instance, std::size_t const b,
+                    std::size_t const e) {
+    using execution_space = typename std::decay<decltype(instance)>::type;
+    auto in = make_kernel_range<execution_space>(first, n);
+    auto lease = acquire_reduce_result_lease(instance);
+    auto r = make_binary_op_reducer<T>(lease, f);
+    return reduce_with_reducer(
+        label, Kokkos::RangePolicy<execution_space>(instance, b, e),
+        iterator_reduce_functor<decltype(in), decltype(r)>{in, r}, r, lease);
+  };
+
+  auto futures = instances.co_execute(
+      n,
+      [&](std::size_t const b, std::size_t const e) {
+        return launch(instances.host_instance(), b, e);
+      },
+      [&](std::size_t const b, std::size_t const e) {
+        return launch(instances.device_instance(), b, e);
+      });
+
+  return hpx::dataflow(
+      hpx::launch::sync,
+      [f, init](auto &&host_result, auto &&device_result) {
+        T result = init;
+        for (auto const &v : {host_result.get(), device_result.get()}) {
+          if (v.valid) {
+            result = hpx::invoke(f, result, v.value);
+          }
+        }
+        return result;
+      },
+      std::move(futures.first), std::move(futures.second));
+}
+
+template <typename ExecutionSpace, typename IterB, typename IterE,
+          typename Reducer>
+hpx::shared_future<typename Reducer::value_type>
+reduce_reducer_helper(char const *label, ExecutionSpace &&instance,
+                      IterB first, IterE last, Reducer const &r) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::reduce with a Kokkos reducer requires an executor with "
+                "a single execution space instance");
+  std::size_t const n = std::distance(first, last);
+  auto in = make_kernel_range<ExecutionSpace>(first, n);
+  return reduce_with_reducer(
+      label,
+      Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>(
+          instance, 0, n),
+      iterator_reduce_functor<decltype(in), Reducer>{in, r}, r);
+}
+
+template <typename ExecutionSpace, typename IterB, typename IterE, typename F,
+          typename... Reducers>
+hpx::shared_future<hpx::tuple<typename Reducers::value_type...>>
+reduce_reducers_helper(char const *label, ExecutionSpace &&instance,
+                       IterB first, IterE last, F &&f, Reducers const &...rs) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::reduce with a Kokkos reducer requires an executor with "
+                "a single execution space instance");
+  std::size_t const n = std::distance(first, last);
+  auto in = make_kernel_range<ExecutionSpace>(first, n);
+  return reduce_with_reducers(
+      label,
+      Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>(
+          instance, 0, n),
+      iterator_multi_reduce_functor<decltype(in), typename std::decay<F>::type,
+                                    typename Reducers::value_type...>{
+          in, std::forward<F>(f)},
+      rs...);
+}
+
+// True if F is a binary operation on T rather than a Kokkos reduction functor
+// taking the partial result by non-const reference.
+template <typename T, typename F>
+struct is_binary_reduce_op
+    : std::integral_constant<
+          bool, std::is_invocable_r<T, F, T const &, T const &>::value> {};
+
+// Joins the indices of a one-dimensional policy, converted to T, into the
+// reducer.
+template <typename T, typename Index, typename Reducer>
+struct policy_reduce_functor {
+  using value_type = typename Reducer::value_type;
+
+  Reducer r;
+
+  KOKKOS_INLINE_FUNCTION void operator()(Index const i,
+                                         value_type &update) const {
+    reducer_join_element(r, update, T(i));
+  }
+};
+
+template <typename ExecutionSpace, typename Range, typename T, typename F,
+          typename std::enable_if<
+              Kokkos::is_execution_policy<
+                  typename std::decay<Range>::type>::value &&
+                  !is_binary_reduce_op<T, typename std::decay<F>::type>::value,
+              int>::type = 0>
+hpx::shared_future<T> reduce_range_helper(char const *label,
+                                          ExecutionSpace &&instance,
+                                          Range &&range, T init, F &&f) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::reduce over a Kokkos execution policy requires "
+                "an executor with a single execution space instance");
+  auto lease = acquire_reduce_result_lease(instance);
+  auto result = lease.template allocate<T>();
 
   return parallel_reduce_async(
              label,
              Kokkos::Experimental::require(
-                 Kokkos::RangePolicy<ExecutionSpace>(
-                     instance, 0, std::distance(first, last)),
+                 make_policy_on_instance(instance, range),
                  Kokkos::Experimental::WorkItemProperty::HintLightWeight),
-             KOKKOS_LAMBDA(int const i, T &update) {
-               HPX_KOKKOS_DETAIL_LOG("reduce i = %d", i);
-               update = hpx::invoke(f, update, *(first + i));
-             },
-             result)
-      .then(hpx::launch::sync, [f, init, result](hpx::shared_future<void> &&) {
-        return hpx::invoke(f, init, result());
+             std::forward<F>(f), result)
+      .then(hpx::launch::sync,
+            [init, result, lease](hpx::shared_future<void> &&) mutable {
+              T const value = init + result();
+              lease.release();
+              return value;
+            });
+}
+
+// With a binary operation, the indices of the policy are reduced with the
+// operation, starting from init. Partial results are joined with the same
+// operation.
+template <typename ExecutionSpace, typename Range, typename T, typename F,
+          typename std::enable_if<
+              Kokkos::is_execution_policy<
+                  typename std::decay<Range>::type>::value &&
+                  is_binary_reduce_op<T, typename std::decay<F>::type>::value,
+              int>::type = 0>
+hpx::shared_future<T> reduce_range_helper(char const *label,
+                                          ExecutionSpace &&instance,
+                                          Range &&range, T init, F &&f) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::reduce over a Kokkos execution policy requires "
+                "an executor with a single execution space instance");
+  auto const p = make_policy_on_instance(instance, range);
+  using policy_type = typename std::decay<decltype(p)>::type;
+  static_assert(
+      std::is_same<policy_type,
+                   Kokkos::RangePolicy<
+                       typename std::decay<ExecutionSpace>::type>>::value,
+      "reducing a Kokkos execution policy with a binary operation requires a "
+      "Kokkos::RangePolicy");
+  using index_type = typename policy_type::member_type;
+  auto lease = acquire_reduce_result_lease(instance);
+  auto r = make_binary_op_reducer<T>(lease, std::forward<F>(f));
+
+  return reduce_with_reducer(
+             label, p, policy_reduce_functor<T, index_type, decltype(r)>{r}, r,
+             lease)
+      .then(hpx::launch::sync, [r, init](auto &&v) {
+        return binary_op_reducer_result(r, init, v.get());
       });
 }
+
+template <typename ExecutionSpace, typename Range, typename T, typename F,
+          typename std::enable_if<
+              is_view_or_view_range<typename std::decay<Range>::type>::value,
+              int>::type = 0>
+hpx::shared_future<T> reduce_range_helper(char const *label,
+                                          ExecutionSpace &&instance,
+                                          Range &&range, T init, F &&f) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::reduce over a view requires an executor with a "
+                "single execution space instance");
+  auto const &v = get_view(range);
+  using view_type = typename std::decay<decltype(v)>::type;
+  auto lease = acquire_reduce_result_lease(instance);
+  auto r = make_binary_op_reducer<T>(lease, std::forward<F>(f));
+
+  return reduce_with_reducer(label, make_view_policy(instance, v),
+                             view_reduce_functor<view_type, decltype(r)>{v, r},
+                             r, lease)
+      .then(hpx::launch::sync, [r, init](auto &&v) {
+        return binary_op_reducer_result(r, init, v.get());
+      });
+}
+
+template <
+    typename ExecutionSpace, typename Range, typename T, typename F,
+    typename std::enable_if<
+        !Kokkos::is_execution_policy<typename std::decay<Range>::type>::value &&
+            !is_view_or_view_range<typename std::decay<Range>::type>::value &&
+            hpx::traits::is_range<Range>::value,
+        int>::type = 0>
+hpx::shared_future<T> reduce_range_helper(char const *label,
+                                          ExecutionSpace &&instance,
+                                          Range &&range, T init, F &&f) {
+  return reduce_helper(label, std::forward<ExecutionSpace>(instance),
+                       hpx::util::begin(range), hpx::util::end(range), init,
+                       std::forward<F>(f));
+}
+
+template <typename ExecutionSpace, typename Range, typename Reducer, typename F,
+          typename std::enable_if<Kokkos::is_execution_policy<
+                                      typename std::decay<Range>::type>::value,
+                                  int>::type = 0>
+hpx::shared_future<typename Reducer::value_type>
+reduce_range_reducer_helper(char const *label, ExecutionSpace &&instance,
+                            Range &&range, Reducer const &r, F &&f) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::reduce over a Kokkos execution policy requires "
+                "an executor with a single execution space instance");
+  return reduce_with_reducer(label, make_policy_on_instance(instance, range),
+                             std::forward<F>(f), r);
+}
+
+template <typename ExecutionSpace, typename Range, typename Reducer,
+          typename std::enable_if<
+              is_view_or_view_range<typename std::decay<Range>::type>::value,
+              int>::type = 0>
+hpx::shared_future<typename Reducer::value_type>
+reduce_range_reducer_helper(char const *label, ExecutionSpace &&instance,
+                            Range &&range, Reducer const &r) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::reduce over a view requires an executor with a "
+                "single execution space instance");
+  auto const &v = get_view(range);
+  using view_type = typename std::decay<decltype(v)>::type;
+  return reduce_with_reducer(label, make_view_policy(instance, v),
+                             view_reduce_functor<view_type, Reducer>{v, r}, r);
+}
+
+template <
+    typename ExecutionSpace, typename Range, typename Reducer,
+    typename std::enable_if<
+        !is_view_or_view_range<typename std::decay<Range>::type>::value &&
+            hpx::traits::is_range<Range>::value,
+        int>::type = 0>
+hpx::shared_future<typename Reducer::value_type>
+reduce_range_reducer_helper(char const *label, ExecutionSpace &&instance,
+                            Range &&range, Reducer const &r) {
+  return reduce_reducer_helper(label, std::forward<ExecutionSpace>(instance),
+                               hpx::util::begin(range), hpx::util::end(range),
+                               r);
+}
+
+template <typename ExecutionSpace, typename Range, typename F,
+          typename... Reducers,
+          typename std::enable_if<Kokkos::is_execution_policy<
+                                      typename std::decay<Range>::type>::value,
+                                  int>::type = 0>
+hpx::shared_future<hpx::tuple<typename Reducers::value_type...>>
+reduce_range_reducers_helper(char const *label, ExecutionSpace &&instance,
+                             Range &&range, F &&f, Reducers const &...rs) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::reduce over a Kokkos execution policy requires "
+                "an executor with a single execution space instance");
+  return reduce_with_reducers(label, make_policy_on_instance(instance, range),
+                              std::forward<F>(f), rs...);
+}
+
+template <typename ExecutionSpace, typename Range, typename F,
+          typename... Reducers,
+          typename std::enable_if<
+              is_view_or_view_range<typename std::decay<Range>::type>::value,
+              int>::type = 0>
+hpx::shared_future<hpx::tuple<typename Reducers::value_type...>>
+reduce_range_reducers_helper(char const *label, ExecutionSpace &&instance,
+                             Range &&range, F &&f, Reducers const &...rs) {
+  static_assert(is_single_instance<ExecutionSpace>::value,
+                "hpx::ranges::reduce over a view requires an executor with a "
+                "single execution space instance");
+  auto const &v = get_view(range);
+  using view_type = typename std::decay<decltype(v)>::type;
+  return reduce_with_reducers(
+      label, make_view_policy(instance, v),
+      view_multi_reduce_functor<view_type, typename std::decay<F>::type,
+                                std::make_index_sequence<view_type::rank>,
+                                typename Reducers::value_type...>{
+          v, std::forward<F>(f)},
+      rs...);
+}
+
+template <
+    typename ExecutionSpace, typename Range, typename F, typename... Reducers,
+    typename std::enable_if<
+        !Kokkos::is_execution_policy<typename std::decay<Range>::type>::value &&
+            !is_view_or_view_range<typename std::decay<Range>::type>::value &&
+            hpx::traits::is_range<Range>::value,
+        int>::type = 0>
+hpx::shared_future<hpx::tuple<typename Reducers::value_type...>>
+reduce_range_reducers_helper(char const *label, ExecutionSpace &&instance,
+                             Range &&range, F &&f, Reducers const &...rs) {
+  return reduce_reducers_helper(label, std::forward<ExecutionSpace>(instance),
+                                hpx::util::begin(range), hpx::util::end(range),
+                                std::forward<F>(f), rs...);
+}
+
+template <typename ExecutionSpace, typename IterB, typename IterE, typename F,
+          typename... Reducers, std::size_t... Is>
+auto reduce_reducers_unpack_helper(char const *label, ExecutionSpace &&instance,
+                                   IterB first, IterE last,
+                                   hpx::tuple<Reducers...> const &rs, F &&f,
+                                   std::index_sequence<Is...>) {
+  return reduce_reducers_helper(label, std::forward<ExecutionSpace>(instance),
+                                first, last, std::forward<F>(f),
+                                hpx::get<Is>(rs)...);
+}
+
+template <typename ExecutionSpace, typename Range, typename F,
+          typename... Reducers, std::size_t... Is>
+auto reduce_range_reducers_unpack_helper(char const *label,
+                                         ExecutionSpace &&instance,
+                                         Range &&range,
+                                         hpx::tuple<Reducers...> const &rs,
+                                         F &&f, std::index_sequence<Is...>) {
+  return reduce_range_reducers_helper(
+      label, std::forward<ExecutionSpace>(instance), std::forward<Range>(range),
+      std::forward<F>(f), hpx::get<Is>(rs)...);
+}
+
+template <typename... Ts> struct all_reducers : std::true_type {};
+
+template <typename T, typename... Ts>
+struct all_reducers<T, Ts...>
+    : std::integral_constant<bool, Kokkos::is_reducer<T>::value &&
+                                       all_reducers<Ts...>::value> {};
+
+// True for tuples of Kokkos reducers, used for multi-value reductions.
+template <typename T> struct is_reducer_tuple : std::false_type {};
+
+template <typename... Reducers>
+struct is_reducer_tuple<hpx::tuple<Reducers...>>
+    : std::integral_constant<bool, (sizeof...(Reducers) > 0) &&
+                                       all_reducers<Reducers...>::value> {};
 } // namespace detail
 
-// Reduce non-range overloads
+// Reduce non-range overloads. With a binary operation, the operation is used
+// both for accumulating elements and for joining partial results. The
+// operation must be associative and commutative.
 template <typename ExecutionPolicy, typename Iter, typename T, typename F,
           typename Enable = std::enable_if_t<
-              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+              is_kokkos_execution_policy<
+                  std::decay_t<ExecutionPolicy>>::value &&
+              !Kokkos::is_reducer<T>::value &&
+              !detail::is_reducer_tuple<T>::value>>
 auto tag_invoke(hpx::reduce_t, ExecutionPolicy &&policy, Iter first, Iter last,
                 T init, F &&f) {
   return detail::get_policy_result<ExecutionPolicy>::call(
       detail::reduce_helper(policy.label(), policy.executor().instance(), first,
                             last, init, std::forward<F>(f)));
 }
+
+// Reduce with a Kokkos reducer (e.g. Kokkos::Max or a custom reducer). The
+// elements are joined into the reducer, and the result is written to the
+// reducer's result location as with Kokkos::parallel_reduce. Reducers that
+// reference a scalar make the reduction blocking; construct the reducer with a
+// view in host-accessible memory (e.g. pinned memory for device execution
+// spaces) for asynchronous reductions.
+template <typename ExecutionPolicy, typename Iter, typename Reducer,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<
+                  std::decay_t<ExecutionPolicy>>::value &&
+              Kokkos::is_reducer<std::decay_t<Reducer>>::value>>
+auto tag_invoke(hpx::reduce_t, ExecutionPolicy &&policy, Iter first, Iter last,
+                Reducer const &r) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::reduce_reducer_helper(policy.label(),
+                                    policy.executor().instance(), first, last,
+                                    r));
+}
+
+// Reduce multiple values in a single pass. f is called with an element and
+// one partial result for each reducer. The result is a tuple of the values of
+// the reducers.
+template <typename ExecutionPolicy, typename Iter, typename... Reducers,
+          typename F,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<
+                  std::decay_t<ExecutionPolicy>>::value &&
+              detail::is_reducer_tuple<hpx::tuple<Reducers...>>::value>>
+auto tag_invoke(hpx::reduce_t, ExecutionPolicy &&policy, Iter first, Iter last,
+                hpx::tuple<Reducers...> const &rs, F &&f) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::reduce_reducers_unpack_helper(
+          policy.label(), policy.executor().instance(), first, last, rs,
+          std::forward<F>(f), std::index_sequence_for<Reducers...>{}));
+}
+
+// Reduce range overloads. In addition to regular ranges, the range can be a
+// Kokkos::View of any rank, a Kokkos::RangePolicy, or a Kokkos::MDRangePolicy.
+// With a view, f is a binary reduction operation applied to the elements of
+// the view. With a Kokkos execution policy, f is either a Kokkos reduction
+// functor which is called with the indices and the partial result, in which
+// case partial results are summed and the result is added to init, or a
+// binary operation on T, in which case the indices of a Kokkos::RangePolicy
+// are reduced with f starting from init.
+template <typename ExecutionPolicy, typename Range, typename T, typename F,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<
+                  std::decay_t<ExecutionPolicy>>::value &&
+              !Kokkos::is_reducer<T>::value &&
+              !detail::is_reducer_tuple<T>::value>>
+auto tag_invoke(hpx::ranges::reduce_t, ExecutionPolicy &&policy, Range &&r,
+                T init, F &&f) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::reduce_range_helper(policy.label(), policy.executor().instance(),
+                                  std::forward<Range>(r), init,
+                                  std::forward<F>(f)));
+}
+
+// Reduce range overloads with a Kokkos reducer. Without a functor the elements
+// of the range or view are joined into the reducer. With a Kokkos execution
+// policy as the range, f is a Kokkos reduction functor.
+template <typename ExecutionPolicy, typename Range, typename Reducer,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<
+                  std::decay_t<ExecutionPolicy>>::value &&
+              Kokkos::is_reducer<std::decay_t<Reducer>>::value>>
+auto tag_invoke(hpx::ranges::reduce_t, ExecutionPolicy &&policy, Range &&r,
+                Reducer const &red) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::reduce_range_reducer_helper(policy.label(),
+                                          policy.executor().instance(),
+                                          std::forward<Range>(r), red));
+}
+
+template <typename ExecutionPolicy, typename Range, typename Reducer,
+          typename F,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<
+                  std::decay_t<ExecutionPolicy>>::value &&
+              Kokkos::is_reducer<std::decay_t<Reducer>>::value>>
+auto tag_invoke(hpx::ranges::reduce_t, ExecutionPolicy &&policy, Range &&r,
+                Reducer const &red, F &&f) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::reduce_range_reducer_helper(
+          policy.label(), policy.executor().instance(), std::forward<Range>(r),
+          red, std::forward<F>(f)));
+}
+
+// Reduce multiple values over a range in a single pass. With a Kokkos
+// execution policy as the range, f is called with the indices and one partial
+// result for each reducer. Otherwise f is called with an element and the
+// partial results.
+template <typename ExecutionPolicy, typename Range, typename... Reducers,
+          typename F,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<
+                  std::decay_t<ExecutionPolicy>>::value &&
+              detail::is_reducer_tuple<hpx::tuple<Reducers...>>::value>>
+auto tag_invoke(hpx::ranges::reduce_t, ExecutionPolicy &&policy, Range &&r,
+                hpx::tuple<Reducers...> const &rs, F &&f) {
+  return detail::get_policy_result<ExecutionPolicy>::call(
+      detail::reduce_range_reducers_unpack_helper(
+          policy.label(), policy.executor().instance(), std::forward<Range>(r),
+          rs, std::forward<F>(f), std::index_sequence_for<Reducers...>{}));
+}
 } // namespace kokkos
 } // namespace hpx
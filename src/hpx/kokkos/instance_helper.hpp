@@ -12,6 +12,7 @@
 #include <hpx/kokkos/execution_spaces.hpp>
 #include <hpx/kokkos/executors.hpp>
 #include <hpx/kokkos/make_instance.hpp>
+#include <hpx/kokkos/performance_counters.hpp>
 
 #include <hpx/runtime.hpp>
 
@@ -38,10 +39,13 @@ public:
                 execution_space>());
       }
     }
+    detail::count_instance_helper_instances(num_threads *
+                                            num_instances_per_thread);
   }
 
   execution_space const &get_execution_space(
       std::size_t const thread_num = hpx::get_worker_thread_num()) {
+    detail::count_instance_helper_request();
     return instances[thread_num][++instance_counters[thread_num] %
                                  num_instances_per_thread];
   }
@@ -51,6 +55,27 @@ public:
     return executor<execution_space>(get_execution_space(thread_num));
   }
 
+  /// Returns a set of num_instances instances from the pool of the given
+  /// thread. The instances are distinct if num_instances is at most the number
+  /// of instances per thread.
+  instance_set<execution_space> get_instance_set(
+      std::size_t const num_instances,
+      std::size_t const thread_num = hpx::get_worker_thread_num()) {
+    std::vector<execution_space> set;
+    set.reserve(num_instances);
+    for (std::size_t i = 0; i < num_instances; ++i) {
+      set.push_back(get_execution_space(thread_num));
+    }
+    return instance_set<execution_space>(std::move(set));
+  }
+
+  segmented_executor<execution_space> get_segmented_executor(
+      std::size_t const num_instances,
+      std::size_t const thread_num = hpx::get_worker_thread_num()) {
+    return segmented_executor<execution_space>(
+        get_instance_set(num_instances, thread_num));
+  }
+
 private:
   std::size_t const num_instances_per_thread = 10;
   std::size_t const num_threads = hpx::get_num_worker_threads();
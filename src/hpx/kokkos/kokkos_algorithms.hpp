@@ -9,6 +9,8 @@
 
 #include <hpx/kokkos/detail/logging.hpp>
 #include <hpx/kokkos/future.hpp>
+#include <hpx/kokkos/performance_counters.hpp>
+#include <hpx/kokkos/trace.hpp>
 
 #include <hpx/future.hpp>
 
@@ -23,18 +25,26 @@ template <typename ExecutionPolicy, typename... Args,
 hpx::shared_future<void> parallel_for_async(ExecutionPolicy &&policy,
                                             Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG("calling parallel_for_async with execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_for(policy, std::forward<Args>(args)...);
-  return detail::get_future<typename std::decay<decltype(
-      policy.space())>::type>::call(policy.space());
+  detail::count_kernel_launch<decltype(policy.space())>();
+  return detail::trace_kernel(
+      "parallel_for_async", policy.space(), trace_start,
+      detail::get_future<typename std::decay<decltype(
+          policy.space())>::type>::call(policy.space()));
 }
 
 template <typename... Args>
 hpx::shared_future<void> parallel_for_async(std::size_t const work_count,
                                             Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG("calling parallel_for_async without execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_for(work_count, std::forward<Args>(args)...);
-  return detail::get_future<Kokkos::DefaultExecutionSpace>::call(
-      Kokkos::DefaultExecutionSpace{});
+  detail::count_kernel_launch<Kokkos::DefaultExecutionSpace>();
+  return detail::trace_kernel(
+      "parallel_for_async", Kokkos::DefaultExecutionSpace{}, trace_start,
+      detail::get_future<Kokkos::DefaultExecutionSpace>::call(
+          Kokkos::DefaultExecutionSpace{}));
 }
 
 template <typename ExecutionPolicy, typename... Args>
@@ -43,9 +53,13 @@ hpx::shared_future<void> parallel_for_async(std::string const &label,
                                             Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG(
       "calling parallel_for_async with label and execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_for(label, policy, std::forward<Args>(args)...);
-  return detail::get_future<typename std::decay<decltype(
-      policy.space())>::type>::call(policy.space());
+  detail::count_kernel_launch<decltype(policy.space())>();
+  return detail::trace_kernel(
+      label.c_str(), policy.space(), trace_start,
+      detail::get_future<typename std::decay<decltype(
+          policy.space())>::type>::call(policy.space()));
 }
 
 template <typename ExecutionPolicy, typename... Args,
@@ -54,9 +68,13 @@ template <typename ExecutionPolicy, typename... Args,
 hpx::shared_future<void> parallel_reduce_async(ExecutionPolicy &&policy,
                                                Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG("calling parallel_reduce_async with execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_reduce(policy, std::forward<Args>(args)...);
-  return detail::get_future<typename std::decay<decltype(
-      policy.space())>::type>::call(policy.space());
+  detail::count_kernel_launch<decltype(policy.space())>();
+  return detail::trace_kernel(
+      "parallel_reduce_async", policy.space(), trace_start,
+      detail::get_future<typename std::decay<decltype(
+          policy.space())>::type>::call(policy.space()));
 }
 
 template <typename... Args>
@@ -64,9 +82,13 @@ hpx::shared_future<void> parallel_reduce_async(std::size_t const work_count,
                                                Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG(
       "calling parallel_reduce_async without execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_reduce(work_count, std::forward<Args>(args)...);
-  return detail::get_future<Kokkos::DefaultExecutionSpace>::call(
-      Kokkos::DefaultExecutionSpace{});
+  detail::count_kernel_launch<Kokkos::DefaultExecutionSpace>();
+  return detail::trace_kernel(
+      "parallel_reduce_async", Kokkos::DefaultExecutionSpace{}, trace_start,
+      detail::get_future<Kokkos::DefaultExecutionSpace>::call(
+          Kokkos::DefaultExecutionSpace{}));
 }
 
 template <typename ExecutionPolicy, typename... Args>
@@ -75,9 +97,13 @@ hpx::shared_future<void> parallel_reduce_async(std::string const &label,
                                                Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG(
       "calling parallel_reduce_async with label and execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_reduce(label, policy, std::forward<Args>(args)...);
-  return detail::get_future<typename std::decay<decltype(
-      policy.space())>::type>::call(policy.space());
+  detail::count_kernel_launch<decltype(policy.space())>();
+  return detail::trace_kernel(
+      label.c_str(), policy.space(), trace_start,
+      detail::get_future<typename std::decay<decltype(
+          policy.space())>::type>::call(policy.space()));
 }
 
 template <typename ExecutionPolicy, typename... Args,
@@ -86,18 +112,26 @@ template <typename ExecutionPolicy, typename... Args,
 hpx::shared_future<void> parallel_scan_async(ExecutionPolicy &&policy,
                                              Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG("calling parallel_scan_async with execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_scan(policy, std::forward<Args>(args)...);
-  return detail::get_future<typename std::decay<decltype(
-      policy.space())>::type>::call(policy.space());
+  detail::count_kernel_launch<decltype(policy.space())>();
+  return detail::trace_kernel(
+      "parallel_scan_async", policy.space(), trace_start,
+      detail::get_future<typename std::decay<decltype(
+          policy.space())>::type>::call(policy.space()));
 }
 
 template <typename... Args>
 hpx::shared_future<void> parallel_scan_async(std::size_t const work_count,
                                              Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG("calling parallel_scan_async without execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_scan(work_count, std::forward<Args>(args)...);
-  return detail::get_future<Kokkos::DefaultExecutionSpace>::call(
-      Kokkos::DefaultExecutionSpace{});
+  detail::count_kernel_launch<Kokkos::DefaultExecutionSpace>();
+  return detail::trace_kernel(
+      "parallel_scan_async", Kokkos::DefaultExecutionSpace{}, trace_start,
+      detail::get_future<Kokkos::DefaultExecutionSpace>::call(
+          Kokkos::DefaultExecutionSpace{}));
 }
 
 template <typename ExecutionPolicy, typename... Args>
@@ -106,9 +140,13 @@ hpx::shared_future<void> parallel_scan_async(std::string const &label,
                                              Args &&...args) {
   HPX_KOKKOS_DETAIL_LOG(
       "calling parallel_scan_async with label and execution policy");
+  detail::trace_start_time const trace_start = detail::trace_begin();
   Kokkos::parallel_scan(label, policy, std::forward<Args>(args)...);
-  return detail::get_future<typename std::decay<decltype(
-      policy.space())>::type>::call(policy.space());
+  detail::count_kernel_launch<decltype(policy.space())>();
+  return detail::trace_kernel(
+      label.c_str(), policy.space(), trace_start,
+      detail::get_future<typename std::decay<decltype(
+          policy.space())>::type>::call(policy.space()));
 }
 } // namespace kokkos
 } // namespace hpx
@@ -0,0 +1,191 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains an asynchronous create_mirror_view_and_copy. Mirrors are cached
+/// per source view so that repeated snapshots of a view reuse the same
+/// buffer.
+
+#pragma once
+
+#include <hpx/kokkos/deep_copy.hpp>
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/future.hpp>
+
+#include <hpx/future.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+
+namespace hpx {
+namespace kokkos {
+namespace detail {
+// Mirrors of views that are not accessible from the target space, keyed by
+// the type of the mirror, the allocation record and data pointer of the
+// source view, and its span. The mirrors are type-erased so that one cache
+// can hold mirrors of all types. Each entry holds a reference to the
+// allocation of the source view, so that its address can not be reused for
+// another view while the entry exists. Entries whose source is referenced only
+// by the cache are evicted on the next lookup. Unmanaged source views can not
+// be tracked and are identified by their address only.
+class mirror_cache {
+public:
+  static mirror_cache &get() {
+    static mirror_cache cache;
+    return cache;
+  }
+
+  mirror_cache(mirror_cache const &) = delete;
+  mirror_cache &operator=(mirror_cache const &) = delete;
+
+  template <typename Mirror, typename View>
+  Mirror get_mirror(View const &view) {
+    key_type const key(std::type_index(typeid(Mirror)),
+                       view.impl_track().template get_record<void>(),
+                       view.data(), view.span());
+
+    std::lock_guard<std::mutex> l(mtx);
+    evict_unreferenced();
+
+    auto &entry = mirrors[key];
+    if (entry.mirror) {
+      Mirror const &mirror = *static_cast<Mirror const *>(entry.mirror.get());
+      if (has_same_extents(mirror, view)) {
+        return mirror;
+      }
+    }
+
+    Mirror mirror(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                     std::string(view.label()) + "_mirror"),
+                  view.layout());
+    entry.source = view.impl_track();
+    entry.mirror = std::make_shared<Mirror>(mirror);
+    HPX_KOKKOS_DETAIL_LOG("allocated cached mirror of view %s",
+                          view.label().c_str());
+    return mirror;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> l(mtx);
+    mirrors.clear();
+  }
+
+  std::size_t size() const {
+    std::lock_guard<std::mutex> l(mtx);
+    return mirrors.size();
+  }
+
+private:
+  using key_type =
+      std::tuple<std::type_index, void const *, void const *, std::size_t>;
+
+  struct entry_type {
+    Kokkos::Impl::SharedAllocationTracker source;
+    std::shared_ptr<void> mirror;
+  };
+
+  // Mirrors can not be deallocated after Kokkos has been finalized.
+  mirror_cache() {
+    Kokkos::push_finalize_hook([this]() { clear(); });
+  }
+
+  // Called with the lock held. The use count of untracked allocations is 0.
+  void evict_unreferenced() {
+    for (auto it = mirrors.begin(); it != mirrors.end();) {
+      if (it->second.source.use_count() == 1) {
+        HPX_KOKKOS_DETAIL_LOG("evicting cached mirror of released view");
+        it = mirrors.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  template <typename Mirror, typename View>
+  static bool has_same_extents(Mirror const &mirror, View const &view) {
+    for (unsigned r = 0; r < View::rank; ++r) {
+      if (mirror.extent(r) != view.extent(r)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  mutable std::mutex mtx;
+  std::map<key_type, entry_type> mirrors;
+};
+} // namespace detail
+
+/// The type of the mirror of View in Space returned by
+/// create_mirror_view_and_copy_async: View itself if it is accessible from
+/// Space, otherwise a view of the same data type and layout in Space.
+template <typename Space, typename View>
+using mirror_view_t = typename std::conditional<
+    Kokkos::SpaceAccessibility<typename Space::memory_space,
+                               typename View::memory_space>::accessible,
+    View,
+    decltype(Kokkos::create_mirror(std::declval<Space const &>(),
+                                   std::declval<View const &>()))>::type;
+
+/// \brief Returns a future to a mirror of view in space (a memory or
+/// execution space), holding a copy of view once the future is ready. The copy
+/// is enqueued on instance. If view is already accessible from space, view
+/// itself is returned in a ready future and no copy is made. In that case the
+/// future does not wait for work on view enqueued on instance.
+///
+/// Otherwise the mirror is cached per source view: repeated calls for the same
+/// view return the same mirror, so the mirror is only allocated on the first
+/// call. Each call overwrites the contents of the mirror returned by previous
+/// calls. The cache keeps the allocation of view alive while its mirror is
+/// cached. A cached mirror is released once the cache holds the last
+/// reference to view, at the next call of this function, or with
+/// release_mirror_cache, or when Kokkos is finalized.
+template <typename ExecutionSpace, typename Space, typename View,
+          typename Enable = typename std::enable_if<Kokkos::is_execution_space<
+              typename std::decay<ExecutionSpace>::type>::value>::type>
+hpx::shared_future<mirror_view_t<Space, View>>
+create_mirror_view_and_copy_async(ExecutionSpace &&instance, Space const &,
+                                  View const &view) {
+  using mirror_type = mirror_view_t<Space, View>;
+
+  if constexpr (std::is_same<mirror_type, View>::value) {
+    return hpx::make_ready_future(view);
+  } else {
+    auto mirror =
+        detail::mirror_cache::get().template get_mirror<mirror_type>(view);
+    return deep_copy_async(std::forward<ExecutionSpace>(instance), mirror, view)
+        .then(hpx::launch::sync,
+              [mirror](hpx::shared_future<void> &&f) -> mirror_type {
+                f.get();
+                return mirror;
+              });
+  }
+}
+
+/// \brief Like the overload taking an execution space instance, but enqueues
+/// the copy on a default instance of the execution space of view.
+template <typename Space, typename View,
+          typename Enable =
+              typename std::enable_if<Kokkos::is_view<View>::value>::type>
+auto create_mirror_view_and_copy_async(Space const &space, View const &view) {
+  return create_mirror_view_and_copy_async(typename View::execution_space(),
+                                           space, view);
+}
+
+/// Releases all cached mirrors created by create_mirror_view_and_copy_async.
+/// Mirrors still referenced elsewhere stay alive until their last reference is
+/// gone.
+inline void release_mirror_cache() { detail::mirror_cache::get().clear(); }
+} // namespace kokkos
+} // namespace hpx
@@ -0,0 +1,312 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains HPX performance counters for kernels, futures, and fences of
+/// hpx-kokkos. The counters are only collected and installed when
+/// HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS is defined. They are then available
+/// as /kokkos{locality#*/total}/... counters, e.g. with
+/// --hpx:print-counter=/kokkos{locality#0/total}/count/futures. Otherwise the
+/// counting functions do nothing.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/future.hpp>
+
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+#if !defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
+#error "HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS requires HPX to be built with HPX_WITH_DISTRIBUTED_RUNTIME=ON"
+#endif
+#include <hpx/chrono.hpp>
+#include <hpx/config/version.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime.hpp>
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+namespace kokkos {
+namespace detail {
+// Execution spaces with separate kernel launch counters. Launches on other
+// execution spaces are counted as other.
+enum class counted_execution_space : std::size_t {
+  serial,
+  openmp,
+  threads,
+  hpx,
+  cuda,
+  hip,
+  sycl,
+  other,
+};
+
+constexpr std::size_t num_counted_execution_spaces =
+    std::size_t(counted_execution_space::other) + 1;
+
+template <typename ExecutionSpace>
+constexpr counted_execution_space get_counted_execution_space() {
+#if defined(KOKKOS_ENABLE_SERIAL)
+  if constexpr (std::is_same<ExecutionSpace, Kokkos::Serial>::value) {
+    return counted_execution_space::serial;
+  }
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+  if constexpr (std::is_same<ExecutionSpace, Kokkos::OpenMP>::value) {
+    return counted_execution_space::openmp;
+  }
+#endif
+#if defined(KOKKOS_ENABLE_THREADS)
+  if constexpr (std::is_same<ExecutionSpace, Kokkos::Threads>::value) {
+    return counted_execution_space::threads;
+  }
+#endif
+#if defined(KOKKOS_ENABLE_HPX)
+  if constexpr (std::is_same<ExecutionSpace,
+                             Kokkos::Experimental::HPX>::value) {
+    return counted_execution_space::hpx;
+  }
+#endif
+#if defined(KOKKOS_ENABLE_CUDA)
+  if constexpr (std::is_same<ExecutionSpace, Kokkos::Cuda>::value) {
+    return counted_execution_space::cuda;
+  }
+#endif
+#if defined(KOKKOS_ENABLE_HIP)
+  if constexpr (std::is_same<ExecutionSpace,
+                             Kokkos::Experimental::HIP>::value) {
+    return counted_execution_space::hip;
+  }
+#endif
+#if defined(KOKKOS_ENABLE_SYCL)
+  if constexpr (std::is_same<ExecutionSpace,
+                             Kokkos::Experimental::SYCL>::value) {
+    return counted_execution_space::sycl;
+  }
+#endif
+  return counted_execution_space::other;
+}
+
+inline char const *
+counted_execution_space_name(counted_execution_space const space) {
+  switch (space) {
+  case counted_execution_space::serial:
+    return "serial";
+  case counted_execution_space::openmp:
+    return "openmp";
+  case counted_execution_space::threads:
+    return "threads";
+  case counted_execution_space::hpx:
+    return "hpx";
+  case counted_execution_space::cuda:
+    return "cuda";
+  case counted_execution_space::hip:
+    return "hip";
+  case counted_execution_space::sycl:
+    return "sycl";
+  case counted_execution_space::other:
+    break;
+  }
+  return "other";
+}
+
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+// The values of all counters. Counts are reset when read with reset, gauges
+// (outstanding futures) are not.
+struct performance_counter_data {
+  static performance_counter_data &get() {
+    static performance_counter_data data;
+    return data;
+  }
+
+  static std::int64_t read(std::atomic<std::int64_t> &counter,
+                           bool const reset) {
+    return reset ? counter.exchange(0) : counter.load();
+  }
+
+  std::atomic<std::int64_t> launches[num_counted_execution_spaces] = {};
+  std::atomic<std::int64_t> futures{0};
+  std::atomic<std::int64_t> outstanding_futures{0};
+  std::atomic<std::int64_t> fence_fallbacks{0};
+  std::atomic<std::int64_t> fence_time{0};
+  std::atomic<std::int64_t> instance_helper_instances{0};
+  std::atomic<std::int64_t> instance_helper_requests{0};
+};
+
+inline bool is_counted_execution_space_enabled(
+    counted_execution_space const space) {
+  switch (space) {
+#if defined(KOKKOS_ENABLE_SERIAL)
+  case counted_execution_space::serial:
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+  case counted_execution_space::openmp:
+#endif
+#if defined(KOKKOS_ENABLE_THREADS)
+  case counted_execution_space::threads:
+#endif
+#if defined(KOKKOS_ENABLE_HPX)
+  case counted_execution_space::hpx:
+#endif
+#if defined(KOKKOS_ENABLE_CUDA)
+  case counted_execution_space::cuda:
+#endif
+#if defined(KOKKOS_ENABLE_HIP)
+  case counted_execution_space::hip:
+#endif
+#if defined(KOKKOS_ENABLE_SYCL)
+  case counted_execution_space::sycl:
+#endif
+  case counted_execution_space::other:
+    return true;
+  default:
+    return false;
+  }
+}
+
+inline void install_performance_counter(
+    std::string const &name, std::atomic<std::int64_t> &counter,
+    bool const resettable, std::string const &helptext,
+    std::string const &unit = "") {
+#if HPX_VERSION_FULL >= 0x010900
+  auto const type =
+      resettable
+          ? hpx::performance_counters::counter_type::monotonically_increasing
+          : hpx::performance_counters::counter_type::raw;
+#else
+  auto const type =
+      resettable ? hpx::performance_counters::counter_monotonically_increasing
+                 : hpx::performance_counters::counter_raw;
+#endif
+  // Installing fails if the counter has already been installed, e.g. by
+  // another shared library including this header. The error is ignored.
+  hpx::error_code ec;
+  hpx::performance_counters::install_counter_type(
+      name,
+      [&counter, resettable](bool const reset) {
+        return performance_counter_data::read(counter, resettable && reset);
+      },
+      helptext, unit, type, ec);
+}
+
+inline void install_performance_counters() {
+  auto &data = performance_counter_data::get();
+
+  for (std::size_t i = 0; i < num_counted_execution_spaces; ++i) {
+    auto const space = static_cast<counted_execution_space>(i);
+    if (is_counted_execution_space_enabled(space)) {
+      std::string const name = counted_execution_space_name(space);
+      install_performance_counter(
+          "/kokkos/count/launches/" + name, data.launches[i], true,
+          "returns the number of kernels launched by hpx-kokkos on " + name +
+              " execution space instances");
+    }
+  }
+
+  install_performance_counter(
+      "/kokkos/count/futures", data.futures, true,
+      "returns the number of futures created for execution space instances");
+  install_performance_counter(
+      "/kokkos/count/outstanding-futures", data.outstanding_futures, false,
+      "returns the number of futures for execution space instances that are "
+      "not yet ready");
+  install_performance_counter(
+      "/kokkos/count/fence-fallbacks", data.fence_fallbacks, true,
+      "returns the number of futures created by fencing an execution space "
+      "instance that has no asynchronous completion mechanism");
+  install_performance_counter(
+      "/kokkos/time/fences", data.fence_time, true,
+      "returns the time spent blocked in fences of execution space instances",
+      "ns");
+  install_performance_counter(
+      "/kokkos/count/instance-helper/instances",
+      data.instance_helper_instances, true,
+      "returns the number of execution space instances created by "
+      "kokkos_instance_helper");
+  install_performance_counter(
+      "/kokkos/count/instance-helper/requests", data.instance_helper_requests,
+      true,
+      "returns the number of execution space instances handed out by "
+      "kokkos_instance_helper");
+}
+
+// The counters are installed when the HPX runtime starts.
+inline bool const performance_counters_registered =
+    (hpx::register_pre_startup_function(&install_performance_counters), true);
+#endif
+
+template <typename ExecutionSpace> void count_kernel_launch() {
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+  constexpr std::size_t i = static_cast<std::size_t>(
+      get_counted_execution_space<
+          typename std::decay<ExecutionSpace>::type>());
+  performance_counter_data::get().launches[i].fetch_add(
+      1, std::memory_order_relaxed);
+#endif
+}
+
+// Counts f as a created future, and as outstanding until it is ready.
+// Returns f.
+inline hpx::shared_future<void> count_future(hpx::shared_future<void> f) {
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+  auto &data = performance_counter_data::get();
+  data.futures.fetch_add(1, std::memory_order_relaxed);
+  if (!f.is_ready()) {
+    data.outstanding_futures.fetch_add(1, std::memory_order_relaxed);
+    f.then(hpx::launch::sync, [](hpx::shared_future<void> &&) {
+      performance_counter_data::get().outstanding_futures.fetch_sub(
+          1, std::memory_order_relaxed);
+    });
+  }
+#endif
+  return f;
+}
+
+// Fences inst, counting the time spent blocked in the fence.
+template <typename E> void counted_fence(E const &inst) {
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+  auto const start = hpx::chrono::high_resolution_clock::now();
+  inst.fence();
+  performance_counter_data::get().fence_time.fetch_add(
+      std::int64_t(hpx::chrono::high_resolution_clock::now() - start),
+      std::memory_order_relaxed);
+#else
+  inst.fence();
+#endif
+}
+
+inline void count_fence_fallback() {
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+  performance_counter_data::get().fence_fallbacks.fetch_add(
+      1, std::memory_order_relaxed);
+#endif
+}
+
+inline void count_instance_helper_instances(std::size_t const n) {
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+  performance_counter_data::get().instance_helper_instances.fetch_add(
+      std::int64_t(n), std::memory_order_relaxed);
+#else
+  (void)n;
+#endif
+}
+
+inline void count_instance_helper_request() {
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+  performance_counter_data::get().instance_helper_requests.fetch_add(
+      1, std::memory_order_relaxed);
+#endif
+}
+} // namespace detail
+} // namespace kokkos
+} // namespace hpx
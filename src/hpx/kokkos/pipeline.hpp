@@ -0,0 +1,311 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains lazy algorithm pipelines that are fused into a single Kokkos
+/// kernel. A pipeline is built from a source range and a chain of stages
+/// (transform, filter, inspect) and is only launched when a terminal operation
+/// (for_each, reduce) is called. All stages are applied to each element within
+/// one kernel, so memory is streamed only once.
+
+#pragma once
+
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/hpx_algorithms_reduce.hpp>
+#include <hpx/kokkos/kokkos_algorithms.hpp>
+#include <hpx/kokkos/policy.hpp>
+#include <hpx/kokkos/view.hpp>
+
+#include <hpx/algorithm.hpp>
+#include <hpx/functional.hpp>
+#include <hpx/future.hpp>
+#include <hpx/tuple.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+namespace kokkos {
+namespace detail {
+// Sources produce the input element for a flat index in [0, size()).
+template <typename View> struct pipeline_view_source {
+  View v;
+
+  std::int64_t size() const { return v.extent(0); }
+  KOKKOS_INLINE_FUNCTION decltype(auto) operator()(std::int64_t i) const {
+    return v(i);
+  }
+};
+
+template <typename Iter> struct pipeline_iterator_source {
+  Iter first;
+  std::int64_t n;
+
+  std::int64_t size() const { return n; }
+  KOKKOS_INLINE_FUNCTION decltype(auto) operator()(std::int64_t i) const {
+    return *(first + i);
+  }
+};
+
+template <typename Index> struct pipeline_index_source {
+  Index begin;
+  Index end;
+
+  std::int64_t size() const { return end - begin; }
+  KOKKOS_INLINE_FUNCTION Index operator()(std::int64_t i) const {
+    return begin + i;
+  }
+};
+
+// Stages take an element and a continuation, which is called with the
+// element(s) passed on to the next stage.
+template <typename F> struct pipeline_transform_stage {
+  F f;
+
+  template <typename T, typename K>
+  KOKKOS_INLINE_FUNCTION void operator()(T &&x, K const &k) const {
+    k(hpx::invoke(f, std::forward<T>(x)));
+  }
+};
+
+template <typename P> struct pipeline_filter_stage {
+  P p;
+
+  template <typename T, typename K>
+  KOKKOS_INLINE_FUNCTION void operator()(T &&x, K const &k) const {
+    if (hpx::invoke(p, x)) {
+      k(std::forward<T>(x));
+    }
+  }
+};
+
+template <typename F> struct pipeline_inspect_stage {
+  F f;
+
+  template <typename T, typename K>
+  KOKKOS_INLINE_FUNCTION void operator()(T &&x, K const &k) const {
+    hpx::invoke(f, x);
+    k(std::forward<T>(x));
+  }
+};
+
+template <std::size_t I, typename Stages, typename T, typename Sink>
+KOKKOS_INLINE_FUNCTION void pipeline_apply(Stages const &stages, T &&x,
+                                           Sink const &sink) {
+  if constexpr (I == hpx::tuple_size<Stages>::value) {
+    sink(std::forward<T>(x));
+  } else {
+    hpx::get<I>(stages)(std::forward<T>(x), [&](auto &&y) {
+      pipeline_apply<I + 1>(stages, std::forward<decltype(y)>(y), sink);
+    });
+  }
+}
+
+template <typename Source, typename Stages, typename F>
+struct pipeline_for_each_functor {
+  Source source;
+  Stages stages;
+  F f;
+
+  KOKKOS_INLINE_FUNCTION void operator()(std::int64_t const i) const {
+    pipeline_apply<0>(stages, source(i),
+                      [&](auto &&y) { hpx::invoke(f, y); });
+  }
+};
+
+template <typename Source, typename Stages, typename Reducer>
+struct pipeline_reduce_functor {
+  using value_type = typename Reducer::value_type;
+
+  Source source;
+  Stages stages;
+  Reducer r;
+
+  KOKKOS_INLINE_FUNCTION void operator()(std::int64_t const i,
+                                         value_type &update) const {
+    pipeline_apply<0>(stages, source(i), [&](auto const &y) {
+      reducer_join_element(r, update, y);
+    });
+  }
+};
+
+template <typename View,
+          typename std::enable_if<
+              Kokkos::is_view<typename std::decay<View>::type>::value,
+              int>::type = 0>
+pipeline_view_source<typename std::decay<View>::type>
+make_pipeline_source(View &&v) {
+  static_assert(std::decay<View>::type::rank == 1,
+                "hpx::kokkos::pipeline requires a view of rank 1");
+  return {std::forward<View>(v)};
+}
+
+template <typename... Args>
+pipeline_index_source<typename Kokkos::RangePolicy<Args...>::index_type>
+make_pipeline_source(Kokkos::RangePolicy<Args...> const &p) {
+  return {p.begin(), p.end()};
+}
+
+// Views of higher rank are traversed with a view_iterator.
+template <typename View>
+auto make_pipeline_source(view_range<View> const &r) {
+  if constexpr (View::rank == 1) {
+    return make_pipeline_source(r.view());
+  } else {
+    return pipeline_iterator_source<typename view_range<View>::iterator>{
+        r.begin(), std::int64_t(r.size())};
+  }
+}
+
+template <typename Range,
+          typename std::enable_if<
+              !is_view_or_view_range<typename std::decay<Range>::type>::value &&
+                  hpx::traits::is_range<Range>::value,
+              int>::type = 0>
+auto make_pipeline_source(Range &&r) {
+  auto first = hpx::util::begin(r);
+  return pipeline_iterator_source<decltype(first)>{
+      first, std::int64_t(std::distance(first, hpx::util::end(r)))};
+}
+} // namespace detail
+
+/// A lazy chain of stages over a source range, launched as a single fused
+/// Kokkos kernel by one of the terminal operations. Use
+/// hpx::kokkos::pipeline to create pipelines.
+template <typename ExecutionPolicy, typename Source, typename... Stages>
+class pipeline_t {
+public:
+  pipeline_t(ExecutionPolicy policy, Source source,
+             hpx::tuple<Stages...> stages)
+      : policy(std::move(policy)), source(std::move(source)),
+        stages(std::move(stages)) {}
+
+  /// Applies f to each element passed to this stage.
+  template <typename F> auto transform(F &&f) const {
+    return append(
+        detail::pipeline_transform_stage<typename std::decay<F>::type>{
+            std::forward<F>(f)});
+  }
+
+  /// Only passes on elements for which p returns true.
+  template <typename P> auto filter(P &&p) const {
+    return append(detail::pipeline_filter_stage<typename std::decay<P>::type>{
+        std::forward<P>(p)});
+  }
+
+  /// Calls f with each element passed to this stage for side effects and
+  /// passes the element on unchanged.
+  template <typename F> auto inspect(F &&f) const {
+    return append(
+        detail::pipeline_inspect_stage<typename std::decay<F>::type>{
+            std::forward<F>(f)});
+  }
+
+  /// Launches the pipeline, calling f with each element reaching the end of
+  /// the pipeline.
+  template <typename F> auto for_each(F &&f) const {
+    using functor_type = detail::pipeline_for_each_functor<
+        Source, hpx::tuple<Stages...>, typename std::decay<F>::type>;
+    return detail::get_policy_result<ExecutionPolicy>::call(parallel_for_async(
+        policy.label(),
+        Kokkos::Experimental::require(
+            Kokkos::RangePolicy<execution_space>(policy.executor().instance(),
+                                                 0, source.size()),
+            Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+        functor_type{source, stages, std::forward<F>(f)}));
+  }
+
+  /// Launches the pipeline, reducing the elements reaching the end of the
+  /// pipeline with the binary operation f. The operation must be associative
+  /// and commutative.
+  template <typename T, typename F,
+            typename Enable =
+                std::enable_if_t<!Kokkos::is_reducer<std::decay_t<T>>::value>>
+  auto reduce(T init, F &&f) const {
+    auto lease =
+        detail::acquire_reduce_result_lease(policy.executor().instance());
+    auto r = detail::make_binary_op_reducer<T>(lease, std::forward<F>(f));
+    using functor_type =
+        detail::pipeline_reduce_functor<Source, hpx::tuple<Stages...>,
+                                        decltype(r)>;
+    hpx::shared_future<T> fut =
+        detail::reduce_with_reducer(
+            policy.label(),
+            Kokkos::RangePolicy<execution_space>(policy.executor().instance(),
+                                                 0, source.size()),
+            functor_type{source, stages, r}, r, lease)
+            .then(hpx::launch::sync, [r, init](auto &&v) {
+              return detail::binary_op_reducer_result(r, init, v.get());
+            });
+    return detail::get_policy_result<ExecutionPolicy>::call(std::move(fut));
+  }
+
+  /// Launches the pipeline, joining the elements reaching the end of the
+  /// pipeline into the Kokkos reducer r.
+  template <typename Reducer,
+            typename Enable = std::enable_if_t<
+                Kokkos::is_reducer<std::decay_t<Reducer>>::value>>
+  auto reduce(Reducer const &r) const {
+    using functor_type =
+        detail::pipeline_reduce_functor<Source, hpx::tuple<Stages...>,
+                                        Reducer>;
+    return detail::get_policy_result<ExecutionPolicy>::call(
+        detail::reduce_with_reducer(
+            policy.label(),
+            Kokkos::RangePolicy<execution_space>(policy.executor().instance(),
+                                                 0, source.size()),
+            functor_type{source, stages, r}, r));
+  }
+
+private:
+  using execution_space = typename std::decay<
+      decltype(std::declval<ExecutionPolicy>().executor().instance())>::type;
+  static_assert(detail::is_single_instance<execution_space>::value,
+                "hpx::kokkos::pipeline requires an executor with a single "
+                "execution space instance");
+
+  template <typename Stage> auto append(Stage &&stage) const {
+    return pipeline_t<ExecutionPolicy, Source, Stages...,
+                      typename std::decay<Stage>::type>(
+        policy, source,
+        hpx::tuple_cat(stages, hpx::make_tuple(std::forward<Stage>(stage))));
+  }
+
+  ExecutionPolicy policy;
+  Source source;
+  hpx::tuple<Stages...> stages;
+};
+
+/// Creates a pipeline over a range. The range can be a rank 1 Kokkos::View, a
+/// view_range of any rank, a Kokkos::RangePolicy (in which case the elements
+/// are the indices), or a range with random access iterators that are
+/// accessible from the execution space of the policy.
+template <typename ExecutionPolicy, typename Range,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto pipeline(ExecutionPolicy &&policy, Range &&r) {
+  auto source = detail::make_pipeline_source(std::forward<Range>(r));
+  return pipeline_t<std::decay_t<ExecutionPolicy>, decltype(source)>(
+      std::forward<ExecutionPolicy>(policy), std::move(source),
+      hpx::tuple<>());
+}
+
+/// Creates a pipeline over the iterator range [first, last).
+template <typename ExecutionPolicy, typename Iter,
+          typename Enable = std::enable_if_t<
+              is_kokkos_execution_policy<std::decay_t<ExecutionPolicy>>::value>>
+auto pipeline(ExecutionPolicy &&policy, Iter first, Iter last) {
+  using source_type = detail::pipeline_iterator_source<Iter>;
+  return pipeline_t<std::decay_t<ExecutionPolicy>, source_type>(
+      std::forward<ExecutionPolicy>(policy),
+      source_type{first, std::int64_t(std::distance(first, last))},
+      hpx::tuple<>());
+}
+} // namespace kokkos
+} // namespace hpx
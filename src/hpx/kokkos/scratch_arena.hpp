@@ -0,0 +1,295 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains per-instance scratch arenas for temporaries of asynchronous
+/// algorithms. Memory is bump-allocated from a buffer while leases on the
+/// arena are alive. When a lease is released, the buffer is rolled back to
+/// the end of the memory of the remaining leases, and its overflow blocks are
+/// deallocated. The buffer grows to the largest amount of memory used at
+/// once, so that in steady state no allocations are done.
+
+#pragma once
+
+#include <hpx/kokkos/detail/logging.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+namespace kokkos {
+template <typename MemorySpace> class scratch_arena;
+
+/// Counters of a scratch_arena.
+struct scratch_arena_statistics {
+  /// Number of allocations from the memory space, including allocations of
+  /// the arena buffer and of overflow blocks.
+  std::size_t num_allocations = 0;
+  /// Number of leases acquired.
+  std::size_t num_leases = 0;
+  /// Current size of the arena buffer in bytes.
+  std::size_t capacity = 0;
+  /// Number of bytes currently allocated in overflow blocks.
+  std::size_t overflow_bytes = 0;
+};
+
+/// \brief A lease on a scratch_arena, typically held for the duration of one
+/// algorithm launch. Memory allocated through a lease is valid until the
+/// lease and all its copies have been destroyed. A lease should be released
+/// only after the work using its memory has completed, e.g. by capturing it
+/// in a continuation.
+template <typename MemorySpace> class scratch_lease {
+public:
+  using memory_space = MemorySpace;
+  template <typename DataType>
+  using view_type = Kokkos::View<DataType, memory_space,
+                                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  scratch_lease() = default;
+
+  /// Allocates an unmanaged rank 1 view of n elements.
+  template <typename T> view_type<T *> allocate(std::size_t const n) const {
+    return view_type<T *>(static_cast<T *>(arena->bump(
+                              *state, n * sizeof(T), alignof(T))),
+                          n);
+  }
+
+  /// Allocates an unmanaged rank 0 view.
+  template <typename T> view_type<T> allocate() const {
+    return view_type<T>(
+        static_cast<T *>(arena->bump(*state, sizeof(T), alignof(T))));
+  }
+
+  /// Releases this copy of the lease. Continuations that hold a lease should
+  /// release it explicitly, since they may be destroyed later than they run.
+  void release() {
+    state.reset();
+    arena = nullptr;
+  }
+
+private:
+  friend class scratch_arena<MemorySpace>;
+  using record_type = typename scratch_arena<MemorySpace>::lease_record;
+
+  scratch_lease(scratch_arena<MemorySpace> *arena, record_type *record)
+      : arena(arena), state(record, [arena](record_type *r) {
+          arena->release(r);
+        }) {}
+
+  scratch_arena<MemorySpace> *arena = nullptr;
+  std::shared_ptr<record_type> state;
+};
+
+/// \brief A bump allocator for temporaries in MemorySpace. Use
+/// get_scratch_arena to get the arena of an execution space instance and
+/// acquire to get a lease for allocating from it. If the buffer is too small
+/// while leases are alive, overflow blocks are allocated separately and
+/// deallocated when the lease that allocated them is released. Releasing a
+/// lease makes the buffer memory above the allocations of all remaining
+/// leases available again, so a long-lived lease does not prevent reuse of
+/// the memory of later leases. The next time a lease is acquired when no
+/// other leases are alive, the buffer is grown to the largest amount of
+/// memory used so far.
+template <typename MemorySpace> class scratch_arena {
+public:
+  using memory_space = MemorySpace;
+
+  /// Use get_scratch_arena instead of constructing arenas directly. Arenas
+  /// must live until Kokkos is finalized.
+  scratch_arena() {
+    // Memory can not be deallocated after Kokkos has been finalized.
+    Kokkos::push_finalize_hook([this]() {
+      std::lock_guard<std::mutex> l(mtx);
+      deallocate_all();
+    });
+  }
+
+  scratch_arena(scratch_arena const &) = delete;
+  scratch_arena &operator=(scratch_arena const &) = delete;
+
+  scratch_lease<memory_space> acquire() {
+    auto record = std::make_unique<lease_record>();
+
+    std::lock_guard<std::mutex> l(mtx);
+    if (active_leases.empty()) {
+      grow();
+    }
+    active_leases.push_back(record.get());
+    ++stats.num_leases;
+    return scratch_lease<memory_space>(this, record.release());
+  }
+
+  scratch_arena_statistics statistics() const {
+    std::lock_guard<std::mutex> l(mtx);
+    return stats;
+  }
+
+private:
+  friend class scratch_lease<memory_space>;
+
+  // The memory of one lease: the end of its allocations in the buffer, and
+  // the overflow blocks allocated for it.
+  struct lease_record {
+    std::size_t end = 0;
+    std::vector<std::pair<void *, std::size_t>> overflow;
+  };
+
+  void *bump(lease_record &record, std::size_t const bytes,
+             std::size_t const alignment) {
+    std::lock_guard<std::mutex> l(mtx);
+    std::size_t const aligned_offset =
+        (offset + alignment - 1) / alignment * alignment;
+    if (aligned_offset + bytes <= stats.capacity) {
+      offset = aligned_offset + bytes;
+      record.end = offset;
+      high_water = (std::max)(high_water, offset + stats.overflow_bytes);
+      return static_cast<char *>(buffer) + aligned_offset;
+    }
+
+    void *p = memory_space().allocate("hpx_kokkos_scratch_overflow", bytes);
+    ++stats.num_allocations;
+    record.overflow.emplace_back(p, bytes);
+    stats.overflow_bytes += bytes;
+    high_water =
+        (std::max)(high_water, offset + stats.overflow_bytes + alignment);
+    HPX_KOKKOS_DETAIL_LOG("allocated scratch overflow block of size %zu",
+                          bytes);
+    return p;
+  }
+
+  // Called when the last copy of a lease is destroyed or released. The
+  // buffer is rolled back to the end of the allocations of the remaining
+  // leases.
+  void release(lease_record *record) {
+    std::unique_ptr<lease_record> r(record);
+
+    std::lock_guard<std::mutex> l(mtx);
+    deallocate_overflow(*r);
+    active_leases.erase(
+        std::find(active_leases.begin(), active_leases.end(), record));
+    offset = 0;
+    for (lease_record const *a : active_leases) {
+      offset = (std::max)(offset, a->end);
+    }
+  }
+
+  // Called with the lock held when no leases are alive.
+  void grow() {
+    if (high_water <= stats.capacity) {
+      return;
+    }
+
+    deallocate_buffer();
+    std::size_t capacity = min_capacity;
+    while (capacity < high_water) {
+      capacity *= 2;
+    }
+    buffer = memory_space().allocate("hpx_kokkos_scratch_arena", capacity);
+    stats.capacity = capacity;
+    ++stats.num_allocations;
+    HPX_KOKKOS_DETAIL_LOG("grew scratch arena to %zu bytes", capacity);
+  }
+
+  void deallocate_overflow(lease_record &record) {
+    for (auto const &b : record.overflow) {
+      memory_space().deallocate(b.first, b.second);
+      stats.overflow_bytes -= b.second;
+    }
+    record.overflow.clear();
+  }
+
+  void deallocate_buffer() {
+    if (buffer != nullptr) {
+      memory_space().deallocate(buffer, stats.capacity);
+      buffer = nullptr;
+      stats.capacity = 0;
+    }
+  }
+
+  void deallocate_all() {
+    for (lease_record *a : active_leases) {
+      deallocate_overflow(*a);
+    }
+    deallocate_buffer();
+  }
+
+  static constexpr std::size_t min_capacity = 4096;
+
+  mutable std::mutex mtx;
+  void *buffer = nullptr;
+  std::size_t offset = 0;
+  std::size_t high_water = 0;
+  std::vector<lease_record *> active_leases;
+  scratch_arena_statistics stats;
+};
+
+namespace detail {
+// Identifies an execution space instance. Instances of execution spaces that
+// are not listed here share a key.
+template <typename ExecutionSpace> struct instance_key {
+  static std::uintptr_t call(ExecutionSpace const &) { return 0; }
+};
+
+#if defined(KOKKOS_ENABLE_CUDA)
+template <> struct instance_key<Kokkos::Cuda> {
+  static std::uintptr_t call(Kokkos::Cuda const &inst) {
+    return reinterpret_cast<std::uintptr_t>(inst.cuda_stream());
+  }
+};
+#endif
+
+#if defined(KOKKOS_ENABLE_HIP)
+template <> struct instance_key<Kokkos::Experimental::HIP> {
+  static std::uintptr_t call(Kokkos::Experimental::HIP const &inst) {
+    return reinterpret_cast<std::uintptr_t>(inst.hip_stream());
+  }
+};
+#endif
+
+#if defined(KOKKOS_ENABLE_SYCL)
+template <> struct instance_key<Kokkos::Experimental::SYCL> {
+  static std::uintptr_t call(Kokkos::Experimental::SYCL const &inst) {
+    return reinterpret_cast<std::uintptr_t>(&(inst.sycl_queue()));
+  }
+};
+#endif
+
+#if defined(KOKKOS_ENABLE_HPX)
+template <> struct instance_key<Kokkos::Experimental::HPX> {
+  static std::uintptr_t call(Kokkos::Experimental::HPX const &inst) {
+    return inst.impl_instance_id();
+  }
+};
+#endif
+} // namespace detail
+
+/// Returns the scratch arena in MemorySpace associated with the given
+/// execution space instance. The arena lives until the end of the program.
+template <typename MemorySpace, typename ExecutionSpace>
+scratch_arena<MemorySpace> &get_scratch_arena(ExecutionSpace const &instance) {
+  static std::mutex mtx;
+  static std::unordered_map<std::uintptr_t,
+                            std::unique_ptr<scratch_arena<MemorySpace>>>
+      arenas;
+
+  std::uintptr_t const key =
+      detail::instance_key<ExecutionSpace>::call(instance);
+  std::lock_guard<std::mutex> l(mtx);
+  auto &arena = arenas[key];
+  if (!arena) {
+    arena = std::make_unique<scratch_arena<MemorySpace>>();
+  }
+  return *arena;
+}
+} // namespace kokkos
+} // namespace hpx
@@ -0,0 +1,336 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains a streaming pipeline that uploads, computes, and downloads a
+/// stream of batches through rotating buffers, overlapping the three stages of
+/// consecutive batches.
+
+#pragma once
+
+#include <hpx/kokkos/deep_copy.hpp>
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/future.hpp>
+#include <hpx/kokkos/make_instance.hpp>
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/tuple.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+namespace kokkos {
+/// Counters of a stream_pipeline. Times are in seconds.
+struct stream_pipeline_statistics {
+  /// Number of batches that have completed all stages.
+  std::size_t num_batches = 0;
+  /// Number of batches that have completed the upload and compute stages.
+  std::size_t num_uploaded_batches = 0;
+  std::size_t num_computed_batches = 0;
+  /// Number of submissions that had to wait for a free buffer.
+  std::size_t num_backpressure_waits = 0;
+  /// Time during which each stage was busy with at least one batch.
+  double upload_busy_time = 0.0;
+  double compute_busy_time = 0.0;
+  double download_busy_time = 0.0;
+  /// Time from the first submission to the completion of the last batch.
+  double elapsed_time = 0.0;
+
+  /// Fraction of the elapsed time during which each stage was busy.
+  double upload_utilization() const { return utilization(upload_busy_time); }
+  double compute_utilization() const {
+    return utilization(compute_busy_time);
+  }
+  double download_utilization() const {
+    return utilization(download_busy_time);
+  }
+
+private:
+  double utilization(double const busy_time) const {
+    return elapsed_time > 0.0 ? (std::min)(1.0, busy_time / elapsed_time)
+                              : 0.0;
+  }
+};
+
+namespace detail {
+enum class stream_pipeline_stage { upload, compute, download };
+
+// State shared with the continuations of the batches, which may outlive the
+// pipeline.
+class stream_pipeline_state {
+public:
+  double now() const { return timer.elapsed(); }
+
+  void start() {
+    std::lock_guard<std::mutex> l(mtx);
+    if (!started) {
+      timer.restart();
+      started = true;
+    }
+  }
+
+  void backpressure_wait() {
+    std::lock_guard<std::mutex> l(mtx);
+    ++stats.num_backpressure_waits;
+  }
+
+  // Adds the part of [begin, end) that does not overlap with the previous
+  // busy interval of the stage. Stages process batches in order, so this is
+  // the time the stage was busy with this batch only.
+  void record(stream_pipeline_stage const stage, double const begin,
+              double const end) {
+    std::lock_guard<std::mutex> l(mtx);
+    if (stage == stream_pipeline_stage::upload) {
+      ++stats.num_uploaded_batches;
+    } else if (stage == stream_pipeline_stage::compute) {
+      ++stats.num_computed_batches;
+    }
+
+    std::size_t const i = static_cast<std::size_t>(stage);
+    double const busy = end - (std::max)(begin, last_end[i]);
+    last_end[i] = (std::max)(last_end[i], end);
+    if (busy <= 0.0) {
+      return;
+    }
+
+    switch (stage) {
+    case stream_pipeline_stage::upload:
+      stats.upload_busy_time += busy;
+      break;
+    case stream_pipeline_stage::compute:
+      stats.compute_busy_time += busy;
+      break;
+    case stream_pipeline_stage::download:
+      stats.download_busy_time += busy;
+      break;
+    }
+  }
+
+  void batch_done(double const end) {
+    std::lock_guard<std::mutex> l(mtx);
+    ++stats.num_batches;
+    stats.elapsed_time = (std::max)(stats.elapsed_time, end);
+  }
+
+  stream_pipeline_statistics statistics() const {
+    std::lock_guard<std::mutex> l(mtx);
+    return stats;
+  }
+
+private:
+  mutable std::mutex mtx;
+  hpx::chrono::high_resolution_timer timer;
+  bool started = false;
+  double last_end[3] = {0.0, 0.0, 0.0};
+  stream_pipeline_statistics stats;
+};
+
+// Returns a future that becomes ready when f is ready and records the
+// interval from begin to then as busy time of the stage.
+inline hpx::shared_future<void>
+record_stream_pipeline_stage(std::shared_ptr<stream_pipeline_state> state,
+                             stream_pipeline_stage const stage,
+                             double const begin, hpx::shared_future<void> f) {
+  return f.then(hpx::launch::sync, [state = std::move(state), stage,
+                                    begin](hpx::shared_future<void> &&f) {
+    state->record(stage, begin, state->now());
+    f.get();
+  });
+}
+} // namespace detail
+
+/// \brief Streams batches through upload, compute, and download stages with
+/// num_buffers rotating pairs of input and output buffers in the memory space
+/// of ExecutionSpace. Each stage runs on its own independent execution space
+/// instance, so that the upload of one batch, the computation of the previous
+/// batch, and the download of the batch before that can overlap. Batches
+/// pass through each stage in submission order.
+///
+/// submit applies backpressure: when all buffers are in use it waits for the
+/// oldest batch to complete. can_submit tells if a buffer is free without
+/// waiting. submit should be called from one thread at a time.
+template <typename InputType, typename OutputType = InputType,
+          typename ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class stream_pipeline {
+public:
+  using execution_space = ExecutionSpace;
+  using memory_space = typename execution_space::memory_space;
+  using input_buffer_type = Kokkos::View<InputType *, memory_space>;
+  using output_buffer_type = Kokkos::View<OutputType *, memory_space>;
+
+  /// Creates a pipeline with buffers for batches of up to batch_size input
+  /// and output elements.
+  explicit stream_pipeline(std::size_t const batch_size,
+                           std::size_t const num_buffers = 2)
+      : max_batch_size(batch_size),
+        upload_instance(detail::make_independent_execution_space_instance<
+                        execution_space>()),
+        compute_instance(detail::make_independent_execution_space_instance<
+                         execution_space>()),
+        download_instance(detail::make_independent_execution_space_instance<
+                          execution_space>()),
+        last_compute(hpx::make_ready_future()),
+        last_download(hpx::make_ready_future()),
+        state(std::make_shared<detail::stream_pipeline_state>()) {
+    if (num_buffers == 0) {
+      throw std::invalid_argument(
+          "hpx::kokkos::stream_pipeline requires at least one buffer");
+    }
+
+    buffers.reserve(num_buffers);
+    for (std::size_t i = 0; i < num_buffers; ++i) {
+      buffers.push_back(
+          {input_buffer_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                                "stream_pipeline_input"),
+                             batch_size),
+           output_buffer_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                                 "stream_pipeline_output"),
+                              batch_size),
+           hpx::make_ready_future()});
+    }
+  }
+
+  std::size_t batch_size() const { return max_batch_size; }
+  std::size_t num_buffers() const { return buffers.size(); }
+
+  /// Returns true if the next call to submit does not have to wait for a
+  /// buffer.
+  bool can_submit() const { return buffers[next_buffer].done.is_ready(); }
+
+  /// \brief Submits a batch. input is copied into an input buffer on the
+  /// upload instance. compute(instance, in, out) is then called with the
+  /// compute instance and subviews of the first input.extent(0) elements of
+  /// the input buffer and the first output.extent(0) elements of the output
+  /// buffer. It must enqueue its work on instance. compute is called on a
+  /// separate HPX thread, so that work it does synchronously (e.g. kernels on
+  /// host execution spaces) overlaps with the other stages and with further
+  /// submissions. The subviews keep the buffers alive until the batch has
+  /// completed, even if the pipeline is destroyed first. Finally, the output
+  /// buffer is copied to output on the download instance. input and output
+  /// are typically host views, and must be kept alive until the returned
+  /// future is ready.
+  template <typename Input, typename Output, typename F>
+  hpx::shared_future<void> submit(Input const &input, Output const &output,
+                                  F &&compute) {
+    if (input.extent(0) > max_batch_size || output.extent(0) > max_batch_size) {
+      throw std::invalid_argument(
+          "hpx::kokkos::stream_pipeline::submit: batch larger than the "
+          "buffers");
+    }
+
+    auto &buffer = buffers[next_buffer];
+    next_buffer = (next_buffer + 1) % buffers.size();
+
+    // Backpressure: the buffer is reused only after its previous batch has
+    // been downloaded.
+    if (!buffer.done.is_ready()) {
+      state->backpressure_wait();
+      buffer.done.wait();
+    }
+    state->start();
+
+    auto const in = Kokkos::subview(
+        buffer.input, std::make_pair(std::size_t(0), input.extent(0)));
+    auto const out = Kokkos::subview(
+        buffer.output, std::make_pair(std::size_t(0), output.extent(0)));
+
+    auto uploaded = detail::record_stream_pipeline_stage(
+        state, detail::stream_pipeline_stage::upload, state->now(),
+        deep_copy_async(upload_instance, in, input));
+
+    // Each stage waits for the previous stage of the same batch and for the
+    // same stage of the previous batch, so that launches on an instance are
+    // ordered. compute is not called inline, since it would block submit if
+    // both futures are already ready.
+    auto computed = hpx::shared_future<void>(
+        hpx::when_all(uploaded, last_compute)
+            .then(hpx::launch::async,
+                  [state = state, instance = compute_instance, in, out,
+                   compute = typename std::decay<F>::type(
+                       std::forward<F>(compute))](auto &&f) {
+                    auto fs = f.get();
+                    hpx::get<0>(fs).get();
+                    double const begin = state->now();
+                    compute(instance, in, out);
+                    return detail::record_stream_pipeline_stage(
+                        state, detail::stream_pipeline_stage::compute, begin,
+                        detail::get_future<execution_space>::call(instance));
+                  }));
+
+    auto downloaded = hpx::shared_future<void>(
+        hpx::when_all(computed, last_download)
+            .then(hpx::launch::sync,
+                  [state = state, instance = download_instance, out,
+                   output](auto &&f) {
+                    auto fs = f.get();
+                    hpx::get<0>(fs).get();
+                    return detail::record_stream_pipeline_stage(
+                        state, detail::stream_pipeline_stage::download,
+                        state->now(), deep_copy_async(instance, output, out));
+                  }));
+
+    buffer.done = downloaded.then(
+        hpx::launch::sync, [state = state](hpx::shared_future<void> &&f) {
+          state->batch_done(state->now());
+          f.get();
+        });
+
+    last_compute = computed;
+    last_download = downloaded;
+
+    HPX_KOKKOS_DETAIL_LOG("stream_pipeline submitted batch of size %zu",
+                          std::size_t(input.extent(0)));
+
+    return buffer.done;
+  }
+
+  /// Returns a future that becomes ready when all submitted batches have
+  /// completed.
+  hpx::shared_future<void> done() const {
+    std::vector<hpx::shared_future<void>> futures;
+    futures.reserve(buffers.size());
+    for (auto const &buffer : buffers) {
+      futures.push_back(buffer.done);
+    }
+
+    return hpx::when_all(std::move(futures))
+        .then(hpx::launch::sync,
+              [](hpx::future<std::vector<hpx::shared_future<void>>> &&f) {
+                for (auto &fut : f.get()) {
+                  fut.get();
+                }
+              });
+  }
+
+  stream_pipeline_statistics statistics() const { return state->statistics(); }
+
+private:
+  struct buffer_set {
+    input_buffer_type input;
+    output_buffer_type output;
+    hpx::shared_future<void> done;
+  };
+
+  std::size_t max_batch_size;
+  execution_space upload_instance;
+  execution_space compute_instance;
+  execution_space download_instance;
+  std::vector<buffer_set> buffers;
+  std::size_t next_buffer = 0;
+  hpx::shared_future<void> last_compute;
+  hpx::shared_future<void> last_download;
+  std::shared_ptr<detail::stream_pipeline_state> state;
+};
+} // namespace kokkos
+} // namespace hpx
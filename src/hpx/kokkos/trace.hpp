@@ -0,0 +1,444 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains tracing of kernel launches, kernel completions, fences, and deep
+/// copies into per-worker ring buffers of fixed-size records. Tracing is
+/// enabled at runtime with enable_tracing. When it is disabled, recording
+/// costs a single relaxed atomic load. Traces are exported in the Chrome trace
+/// event format, which can be viewed in Perfetto or chrome://tracing.
+
+#pragma once
+
+#include <hpx/kokkos/performance_counters.hpp>
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/runtime.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+namespace kokkos {
+/// Default number of trace records kept per worker thread. Older records are
+/// overwritten when a buffer is full.
+constexpr std::size_t default_trace_records_per_thread = std::size_t(1) << 16;
+
+namespace detail {
+enum class trace_event_type : std::uint8_t {
+  launch,
+  complete,
+  fence,
+  deep_copy,
+};
+
+// A trace record. Times are in nanoseconds. Labels longer than the record
+// can hold are truncated.
+struct trace_record {
+  std::uint64_t begin;
+  std::uint64_t end;
+  std::uint32_t instance_id;
+  std::uint16_t worker;
+  trace_event_type type;
+  std::uint8_t space;
+  char label[40];
+};
+
+static_assert(sizeof(trace_record) == 64,
+              "trace records should fill one cache line");
+
+// A ring buffer of trace records. Writers claim slots with a single atomic
+// increment. Each slot has a sequence number that is odd while the slot is
+// written, so that readers can skip slots that are being overwritten.
+class trace_buffer {
+public:
+  explicit trace_buffer(std::size_t const capacity)
+      : mask(capacity - 1), slots(new slot[capacity]) {}
+
+  void push(trace_record const &record) {
+    std::uint64_t const ticket = head.fetch_add(1, std::memory_order_relaxed);
+    slot &s = slots[ticket & mask];
+    s.sequence.store(2 * ticket + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&s.record, &record, sizeof(trace_record));
+    s.sequence.store(2 * ticket + 2, std::memory_order_release);
+  }
+
+  // Appends the completely written records to records.
+  void read(std::vector<trace_record> &records) const {
+    for (std::size_t i = 0; i <= mask; ++i) {
+      slot const &s = slots[i];
+      std::uint64_t const before = s.sequence.load(std::memory_order_acquire);
+      if (before == 0 || before % 2 == 1) {
+        continue;
+      }
+      trace_record record;
+      std::memcpy(&record, &s.record, sizeof(trace_record));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (s.sequence.load(std::memory_order_relaxed) == before) {
+        records.push_back(record);
+      }
+    }
+  }
+
+  // Must not be called concurrently with push.
+  void clear() {
+    head.store(0);
+    for (std::size_t i = 0; i <= mask; ++i) {
+      slots[i].sequence.store(0);
+    }
+  }
+
+  std::size_t capacity() const { return mask + 1; }
+
+private:
+  struct slot {
+    std::atomic<std::uint64_t> sequence{0};
+    trace_record record;
+  };
+
+  std::size_t const mask;
+  std::unique_ptr<slot[]> slots;
+  std::atomic<std::uint64_t> head{0};
+};
+
+// Checked before anything else is done for a trace record. Constant
+// initialized, so that reading it needs no initialization guard.
+inline std::atomic<bool> tracing_enabled_flag{false};
+
+// Owns one buffer per worker thread and one shared by all other threads.
+// Buffers are allocated when tracing is first enabled and live until the end
+// of the program, so that concurrent writers never see them deallocated.
+class tracer {
+public:
+  static tracer &get() {
+    static tracer t;
+    return t;
+  }
+
+  tracer(tracer const &) = delete;
+  tracer &operator=(tracer const &) = delete;
+
+  void enable(std::size_t records_per_thread) {
+    std::lock_guard<std::mutex> l(mtx);
+    if (buffers_ready.load(std::memory_order_acquire) == nullptr) {
+      std::size_t capacity = 1;
+      while (capacity < records_per_thread) {
+        capacity *= 2;
+      }
+      std::size_t const num_buffers = hpx::get_num_worker_threads() + 1;
+      buffers.reserve(num_buffers);
+      for (std::size_t i = 0; i < num_buffers; ++i) {
+        buffers.push_back(std::make_unique<trace_buffer>(capacity));
+      }
+      start = now();
+      buffers_ready.store(&buffers, std::memory_order_release);
+    }
+    tracing_enabled_flag.store(true, std::memory_order_release);
+  }
+
+  void disable() { tracing_enabled_flag.store(false); }
+
+  void clear() {
+    std::lock_guard<std::mutex> l(mtx);
+    if (tracing_enabled_flag.load()) {
+      throw std::runtime_error(
+          "hpx::kokkos::clear_trace: tracing must be disabled");
+    }
+    for (auto &b : buffers) {
+      b->clear();
+    }
+    start = now();
+  }
+
+  void push(trace_record &record) {
+    auto const *bs = buffers_ready.load(std::memory_order_acquire);
+    if (bs == nullptr) {
+      return;
+    }
+    std::size_t const worker = hpx::get_worker_thread_num();
+    std::size_t const i = (std::min)(worker, bs->size() - 1);
+    record.worker = std::uint16_t(i);
+    (*bs)[i]->push(record);
+  }
+
+  // Returns all records, ordered by begin time, and the time at which
+  // tracing was enabled or cleared.
+  std::pair<std::vector<trace_record>, std::uint64_t> records() const {
+    std::lock_guard<std::mutex> l(mtx);
+    std::vector<trace_record> rs;
+    for (auto const &b : buffers) {
+      b->read(rs);
+    }
+    std::sort(rs.begin(), rs.end(),
+              [](trace_record const &a, trace_record const &b) {
+                return a.begin < b.begin;
+              });
+    return {std::move(rs), start};
+  }
+
+  static std::uint64_t now() {
+    return hpx::chrono::high_resolution_clock::now();
+  }
+
+private:
+  tracer() = default;
+
+  mutable std::mutex mtx;
+  std::vector<std::unique_ptr<trace_buffer>> buffers;
+  std::atomic<std::vector<std::unique_ptr<trace_buffer>> *> buffers_ready{
+      nullptr};
+  std::uint64_t start = 0;
+};
+
+inline bool is_tracing_enabled() {
+  return tracing_enabled_flag.load(std::memory_order_relaxed);
+}
+
+// The begin time of a traced operation. Empty if tracing was disabled when
+// the operation started, in which case it is not recorded.
+using trace_start_time = std::optional<std::uint64_t>;
+
+// Returns the current time if tracing is enabled. Passed to the trace_*
+// functions as the begin time of the traced operation.
+inline trace_start_time trace_begin() {
+  if (!is_tracing_enabled()) {
+    return std::nullopt;
+  }
+  return tracer::now();
+}
+
+template <typename E, typename = void>
+struct has_impl_instance_id : std::false_type {};
+
+template <typename E>
+struct has_impl_instance_id<
+    E, std::void_t<decltype(std::declval<E const &>().impl_instance_id())>>
+    : std::true_type {};
+
+template <typename E> std::uint32_t trace_instance_id(E const &inst) {
+  if constexpr (has_impl_instance_id<E>::value) {
+    return std::uint32_t(inst.impl_instance_id());
+  } else {
+    (void)inst;
+    return 0;
+  }
+}
+
+inline void trace(trace_event_type const type, char const *label,
+                  counted_execution_space const space,
+                  std::uint32_t const instance_id, std::uint64_t const begin,
+                  std::uint64_t const end) {
+  trace_record record;
+  record.begin = begin;
+  record.end = end;
+  record.instance_id = instance_id;
+  record.worker = 0;
+  record.type = type;
+  record.space = std::uint8_t(space);
+  std::strncpy(record.label, label, sizeof(record.label) - 1);
+  record.label[sizeof(record.label) - 1] = '\0';
+  tracer::get().push(record);
+}
+
+template <typename E>
+void trace(trace_event_type const type, char const *label, E const &inst,
+           std::uint64_t const begin, std::uint64_t const end) {
+  trace(type, label,
+        get_counted_execution_space<typename std::decay<E>::type>(),
+        trace_instance_id(inst), begin, end);
+}
+
+// Records an operation that started at begin and completes when f is ready.
+// Returns a future that becomes ready when f is ready and the operation has
+// been recorded.
+template <typename E>
+hpx::shared_future<void> trace_until_ready(trace_event_type const type,
+                                           char const *label, E const &inst,
+                                           trace_start_time const start,
+                                           hpx::shared_future<void> f) {
+  if (!start || !is_tracing_enabled()) {
+    return f;
+  }
+
+  std::uint64_t const begin = *start;
+  if (f.is_ready()) {
+    trace(type, label, inst, begin, tracer::now());
+    return f;
+  }
+
+  // The label may not outlive this call, so it is copied.
+  return f.then(
+      hpx::launch::sync,
+      [type, label = std::string(label),
+       space = get_counted_execution_space<typename std::decay<E>::type>(),
+       instance_id = trace_instance_id(inst),
+       begin](hpx::shared_future<void> &&f) {
+        trace(type, label.c_str(), space, instance_id, begin, tracer::now());
+        f.get();
+      });
+}
+
+// Records the launch of a kernel at begin and its completion when f is ready.
+template <typename E>
+hpx::shared_future<void> trace_kernel(char const *label, E const &inst,
+                                      trace_start_time const start,
+                                      hpx::shared_future<void> f) {
+  if (!start || !is_tracing_enabled()) {
+    return f;
+  }
+
+  trace(trace_event_type::launch, label, inst, *start, *start);
+  return trace_until_ready(trace_event_type::complete, label, inst, start,
+                           std::move(f));
+}
+
+// Records a deep copy that started at begin and completes when f is ready.
+template <typename E>
+hpx::shared_future<void> trace_deep_copy(E const &inst,
+                                         trace_start_time const start,
+                                         hpx::shared_future<void> f) {
+  return trace_until_ready(trace_event_type::deep_copy, "deep_copy_async",
+                           inst, start, std::move(f));
+}
+
+// Fences inst, recording the time spent blocked in the fence.
+template <typename E> void traced_fence(E const &inst) {
+  trace_start_time const start = trace_begin();
+  counted_fence(inst);
+  if (start) {
+    trace(trace_event_type::fence, "fence", inst, *start, tracer::now());
+  }
+}
+
+inline void write_trace_json_string(std::ostream &os, char const *s) {
+  os << '"';
+  for (; *s != '\0'; ++s) {
+    unsigned char const c = static_cast<unsigned char>(*s);
+    if (c == '"' || c == '\\') {
+      os << '\\' << *s;
+    } else if (c < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", unsigned(c));
+      os << escaped;
+    } else {
+      os << *s;
+    }
+  }
+  os << '"';
+}
+
+inline char const *trace_event_category(trace_event_type const type) {
+  switch (type) {
+  case trace_event_type::launch:
+    return "launch";
+  case trace_event_type::complete:
+    return "kernel";
+  case trace_event_type::fence:
+    return "fence";
+  case trace_event_type::deep_copy:
+    break;
+  }
+  return "deep_copy";
+}
+} // namespace detail
+
+/// \brief Starts recording trace records. Each worker thread records into its
+/// own ring buffer of records_per_thread records (rounded up to a power of
+/// two), and other threads share one more buffer. The buffers are allocated
+/// on the first call, which must be made while the HPX runtime is running;
+/// later calls reuse them.
+inline void enable_tracing(std::size_t const records_per_thread =
+                               default_trace_records_per_thread) {
+  detail::tracer::get().enable(records_per_thread);
+}
+
+/// Stops recording trace records. Recorded records are kept.
+inline void disable_tracing() { detail::tracer::get().disable(); }
+
+inline bool tracing_enabled() { return detail::is_tracing_enabled(); }
+
+/// Drops all recorded trace records. Tracing must be disabled.
+inline void clear_trace() { detail::tracer::get().clear(); }
+
+/// \brief Writes the recorded trace records in the Chrome trace event format.
+/// Each execution space is shown as a process and each execution space
+/// instance as a thread, so that overlapping kernels on different instances
+/// are shown side by side. Kernels and deep copies span from their launch
+/// until their future became ready, fences span the time blocked in the
+/// fence.
+inline void write_trace_json(std::ostream &os) {
+  auto const records = detail::tracer::get().records();
+  std::uint64_t const start = records.second;
+  bool used_spaces[detail::num_counted_execution_spaces] = {};
+
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  char buffer[64];
+  for (auto const &r : records.first) {
+    if (r.begin < start || r.space >= detail::num_counted_execution_spaces) {
+      continue;
+    }
+    used_spaces[r.space] = true;
+
+    os << (first ? "\n" : ",\n") << "{\"name\":";
+    first = false;
+    detail::write_trace_json_string(os, r.label);
+    os << ",\"cat\":\"" << detail::trace_event_category(r.type) << "\"";
+    std::snprintf(buffer, sizeof(buffer), "%.3f", (r.begin - start) / 1e3);
+    os << ",\"ts\":" << buffer;
+    if (r.type == detail::trace_event_type::launch) {
+      os << ",\"ph\":\"i\",\"s\":\"t\"";
+    } else {
+      std::snprintf(buffer, sizeof(buffer), "%.3f",
+                    (r.end - (std::min)(r.begin, r.end)) / 1e3);
+      os << ",\"ph\":\"X\",\"dur\":" << buffer;
+    }
+    os << ",\"pid\":" << unsigned(r.space) << ",\"tid\":" << r.instance_id
+       << ",\"args\":{\"worker\":" << r.worker << "}}";
+  }
+
+  for (std::size_t i = 0; i < detail::num_counted_execution_spaces; ++i) {
+    if (used_spaces[i]) {
+      os << (first ? "\n" : ",\n") << "{\"name\":\"process_name\",\"ph\":\"M\","
+         << "\"pid\":" << i << ",\"args\":{\"name\":\""
+         << detail::counted_execution_space_name(
+                static_cast<detail::counted_execution_space>(i))
+         << "\"}}";
+      first = false;
+    }
+  }
+  os << "\n]}\n";
+}
+
+/// Writes the recorded trace records to the file at path. See the overload
+/// taking a stream.
+inline void write_trace_json(std::string const &path) {
+  std::ofstream os(path);
+  if (!os) {
+    throw std::runtime_error("hpx::kokkos::write_trace_json: could not open " +
+                             path);
+  }
+  write_trace_json(os);
+}
+} // namespace kokkos
+} // namespace hpx
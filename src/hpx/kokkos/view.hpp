@@ -4,19 +4,431 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 /// \file
-/// Contains helper functions for getting iterators from Kokkos views.
-/// Currently simply returns View::data() for begin, and View::data() +
-/// View::size() for end.
+/// Contains iterators and ranges over the elements of Kokkos views, adapters
+/// from contiguous containers to unmanaged views, and helpers for creating
+/// execution policies covering all elements of a view.
 
 #pragma once
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace hpx {
 namespace kokkos {
-// These two functions do no checking of the validity of using v.data()
-// directly as an iterator. They do not take strides, ranks, etc. into account.
-template <typename V> auto view_begin(V const &v) { return v.data(); }
-template <typename V> auto view_end(V const &v) { return v.data() + v.size(); }
+/// \brief Random access iterator over all elements of a view of any rank and
+/// layout. Elements are visited in the memory order of LayoutLeft and
+/// LayoutRight views, and in row-major order for other layouts. Strides are
+/// taken into account by indexing the view with the multi-dimensional index
+/// of each element. The iterator can be used in kernels.
+template <typename View> class view_iterator {
+public:
+  using view_type = View;
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename View::non_const_value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = typename View::reference_type;
+  using pointer = typename View::pointer_type;
+
+  KOKKOS_DEFAULTED_FUNCTION view_iterator() = default;
+  KOKKOS_INLINE_FUNCTION view_iterator(View const &v, difference_type const i)
+      : v(v), i(i) {}
+
+  KOKKOS_INLINE_FUNCTION View const &view() const { return v; }
+  KOKKOS_INLINE_FUNCTION difference_type index() const { return i; }
+
+  KOKKOS_INLINE_FUNCTION reference operator*() const {
+    return at(i, std::make_index_sequence<View::rank>{});
+  }
+  KOKKOS_INLINE_FUNCTION reference operator[](difference_type const n) const {
+    return at(i + n, std::make_index_sequence<View::rank>{});
+  }
+
+  KOKKOS_INLINE_FUNCTION view_iterator &operator++() {
+    ++i;
+    return *this;
+  }
+  KOKKOS_INLINE_FUNCTION view_iterator operator++(int) {
+    auto it = *this;
+    ++i;
+    return it;
+  }
+  KOKKOS_INLINE_FUNCTION view_iterator &operator--() {
+    --i;
+    return *this;
+  }
+  KOKKOS_INLINE_FUNCTION view_iterator operator--(int) {
+    auto it = *this;
+    --i;
+    return it;
+  }
+  KOKKOS_INLINE_FUNCTION view_iterator &operator+=(difference_type const n) {
+    i += n;
+    return *this;
+  }
+  KOKKOS_INLINE_FUNCTION view_iterator &operator-=(difference_type const n) {
+    i -= n;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION friend view_iterator
+  operator+(view_iterator it, difference_type const n) {
+    return it += n;
+  }
+  KOKKOS_INLINE_FUNCTION friend view_iterator
+  operator+(difference_type const n, view_iterator it) {
+    return it += n;
+  }
+  KOKKOS_INLINE_FUNCTION friend view_iterator
+  operator-(view_iterator it, difference_type const n) {
+    return it -= n;
+  }
+  KOKKOS_INLINE_FUNCTION friend difference_type
+  operator-(view_iterator const &a, view_iterator const &b) {
+    return a.i - b.i;
+  }
+
+  KOKKOS_INLINE_FUNCTION friend bool operator==(view_iterator const &a,
+                                                view_iterator const &b) {
+    return a.i == b.i;
+  }
+  KOKKOS_INLINE_FUNCTION friend bool operator!=(view_iterator const &a,
+                                                view_iterator const &b) {
+    return a.i != b.i;
+  }
+  KOKKOS_INLINE_FUNCTION friend bool operator<(view_iterator const &a,
+                                               view_iterator const &b) {
+    return a.i < b.i;
+  }
+  KOKKOS_INLINE_FUNCTION friend bool operator>(view_iterator const &a,
+                                               view_iterator const &b) {
+    return a.i > b.i;
+  }
+  KOKKOS_INLINE_FUNCTION friend bool operator<=(view_iterator const &a,
+                                                view_iterator const &b) {
+    return a.i <= b.i;
+  }
+  KOKKOS_INLINE_FUNCTION friend bool operator>=(view_iterator const &a,
+                                                view_iterator const &b) {
+    return a.i >= b.i;
+  }
+
+private:
+  // Converts the flat index j to a multi-dimensional index.
+  template <std::size_t... Is>
+  KOKKOS_INLINE_FUNCTION reference at(difference_type j,
+                                      std::index_sequence<Is...>) const {
+    std::int64_t is[View::rank > 0 ? View::rank : 1] = {};
+    if (std::is_same<typename View::array_layout, Kokkos::LayoutLeft>::value) {
+      for (std::size_t r = 0; r < View::rank; ++r) {
+        std::int64_t const extent = v.extent(r);
+        is[r] = j % extent;
+        j /= extent;
+      }
+    } else {
+      for (std::size_t r = View::rank; r > 0; --r) {
+        std::int64_t const extent = v.extent(r - 1);
+        is[r - 1] = j % extent;
+        j /= extent;
+      }
+    }
+    return v(is[Is]...);
+  }
+
+  View v;
+  difference_type i = 0;
+};
+
+namespace detail {
+template <typename View>
+struct view_is_contiguous_rank_1
+    : std::integral_constant<
+          bool,
+          View::rank == 1 &&
+              (std::is_same<typename View::array_layout,
+                            Kokkos::LayoutLeft>::value ||
+               std::is_same<typename View::array_layout,
+                            Kokkos::LayoutRight>::value)> {};
+} // namespace detail
+
+/// Returns an iterator to the first element of the view. Rank 1 views with
+/// LayoutLeft or LayoutRight are contiguous and return View::data(). Other
+/// views return a view_iterator.
+template <typename V> auto view_begin(V const &v) {
+  if constexpr (detail::view_is_contiguous_rank_1<V>::value) {
+    return v.data();
+  } else {
+    return view_iterator<V>(v, 0);
+  }
+}
+
+/// Returns an iterator past the last element of the view. See view_begin.
+template <typename V> auto view_end(V const &v) {
+  if constexpr (detail::view_is_contiguous_rank_1<V>::value) {
+    return v.data() + v.size();
+  } else {
+    return view_iterator<V>(v, v.size());
+  }
+}
+
+/// \brief A range over all elements of a view. The parallel algorithm
+/// specializations for the Kokkos execution policy recognize view ranges (and
+/// views) and launch them with a range policy for rank 1 views and a
+/// multi-dimensional range policy following the layout of the view for
+/// higher ranks. Other algorithms can use the iterators of the range.
+template <typename View> class view_range {
+public:
+  using view_type = View;
+  using iterator = decltype(view_begin(std::declval<View const &>()));
+
+  explicit view_range(View v) : v(std::move(v)) {}
+
+  View const &view() const { return v; }
+  std::size_t size() const { return v.size(); }
+  iterator begin() const { return view_begin(v); }
+  iterator end() const { return view_end(v); }
+
+private:
+  View v;
+};
+
+template <typename View> view_range<View> make_view_range(View const &v) {
+  return view_range<View>(v);
+}
+
+template <typename T> struct is_view_range : std::false_type {};
+template <typename View>
+struct is_view_range<view_range<View>> : std::true_type {};
+
+namespace detail {
+// Tells if std::vector<T> can be named without a hard error, i.e. if T is a
+// complete, cv-unqualified, non-abstract object type. Output iterators have
+// void as value_type.
+template <typename T, typename Enable = void>
+struct is_vector_element_type : std::false_type {};
+
+template <typename T>
+struct is_vector_element_type<T, std::void_t<decltype(sizeof(T))>>
+    : std::integral_constant<bool, std::is_object<T>::value &&
+                                       !std::is_array<T>::value &&
+                                       !std::is_abstract<T>::value &&
+                                       !std::is_const<T>::value &&
+                                       !std::is_volatile<T>::value> {};
+
+template <typename Iter, typename Enable = void>
+struct is_contiguous_class_iterator : std::false_type {};
+
+template <typename Iter>
+struct is_contiguous_class_iterator<
+    Iter, std::enable_if_t<is_vector_element_type<
+              typename std::iterator_traits<Iter>::value_type>::value>> {
+  using value_type = typename std::iterator_traits<Iter>::value_type;
+  using vector_type = std::vector<value_type>;
+
+  // std::vector<bool> is not contiguous.
+  static constexpr bool value =
+      !std::is_same<value_type, bool>::value &&
+      (std::is_same<Iter, typename vector_type::iterator>::value ||
+       std::is_same<Iter, typename vector_type::const_iterator>::value ||
+       std::is_same<Iter, std::string::iterator>::value ||
+       std::is_same<Iter, std::string::const_iterator>::value);
+};
+} // namespace detail
+
+/// Tells if Iter is known to iterate over contiguous memory. This is true for
+/// pointers and for the iterators of std::vector and std::string.
+template <typename Iter>
+struct is_contiguous_iterator
+    : std::integral_constant<
+          bool, std::is_pointer<Iter>::value ||
+                    detail::is_contiguous_class_iterator<Iter>::value> {};
+
+/// The type of the unmanaged view returned by as_view for the given element
+/// type, which may be const.
+template <typename T, typename MemorySpace = Kokkos::HostSpace>
+using unmanaged_view_t =
+    Kokkos::View<T *, MemorySpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+/// \brief Returns an unmanaged rank 1 view of the contiguous range [first,
+/// last). No data is copied and the view does not keep the data alive. The
+/// memory must be accessible from MemorySpace, which is Kokkos::HostSpace by
+/// default.
+template <typename MemorySpace = Kokkos::HostSpace, typename Iter>
+unmanaged_view_t<std::remove_reference_t<decltype(*std::declval<Iter>())>,
+                 MemorySpace>
+as_view(Iter first, Iter last) {
+  static_assert(is_contiguous_iterator<Iter>::value,
+                "hpx::kokkos::as_view requires contiguous iterators");
+  using view_type =
+      unmanaged_view_t<std::remove_reference_t<decltype(*first)>, MemorySpace>;
+  std::size_t const n = std::distance(first, last);
+  return view_type(n == 0 ? nullptr : std::addressof(*first), n);
+}
+
+/// \brief Returns an unmanaged rank 1 view of the elements of a contiguous
+/// container, e.g. std::vector or std::array. See as_view(first, last).
+template <typename MemorySpace = Kokkos::HostSpace, typename Container,
+          typename Enable = decltype(std::data(std::declval<Container &>()))>
+unmanaged_view_t<std::remove_pointer_t<decltype(
+                     std::data(std::declval<Container &>()))>,
+                 MemorySpace>
+as_view(Container &c) {
+  using view_type =
+      unmanaged_view_t<std::remove_pointer_t<decltype(std::data(c))>,
+                       MemorySpace>;
+  return view_type(std::data(c), std::size(c));
+}
+
+namespace detail {
+template <typename T>
+struct is_view_or_view_range
+    : std::integral_constant<bool, Kokkos::is_view<T>::value ||
+                                       is_view_range<T>::value> {};
+
+template <typename View,
+          typename std::enable_if<Kokkos::is_view<View>::value, int>::type = 0>
+View const &get_view(View const &v) {
+  return v;
+}
+
+template <typename View> View const &get_view(view_range<View> const &r) {
+  return r.view();
+}
+
+// Kernels access element i of an input range through kernel_element. For
+// contiguous iterators, make_kernel_range returns an unmanaged view of the n
+// elements starting at first in the memory space of the execution space, so
+// that kernels index the view directly instead of doing iterator arithmetic.
+// Other iterators are passed through.
+template <typename ExecutionSpace, typename Iter>
+auto make_kernel_range(Iter first, std::size_t const n) {
+  if constexpr (is_contiguous_iterator<Iter>::value) {
+    return as_view<typename std::decay<ExecutionSpace>::type::memory_space>(
+        first, first + n);
+  } else {
+    (void)n;
+    return first;
+  }
+}
+
+template <typename T, typename... Properties>
+KOKKOS_INLINE_FUNCTION decltype(auto)
+kernel_element(Kokkos::View<T, Properties...> const &v, std::int64_t const i) {
+  return v(i);
+}
+
+template <typename Iter>
+KOKKOS_INLINE_FUNCTION decltype(auto) kernel_element(Iter const &first,
+                                                     std::int64_t const i) {
+  return *(first + i);
+}
+
+// The iteration order that traverses a view with the given layout in memory
+// order.
+template <typename Layout> struct view_iterate {
+  static constexpr Kokkos::Iterate value = Kokkos::Iterate::Default;
+};
+
+template <> struct view_iterate<Kokkos::LayoutLeft> {
+  static constexpr Kokkos::Iterate value = Kokkos::Iterate::Left;
+};
+
+template <> struct view_iterate<Kokkos::LayoutRight> {
+  static constexpr Kokkos::Iterate value = Kokkos::Iterate::Right;
+};
+
+template <typename ExecutionSpace, typename View>
+using view_mdrange_policy_t = Kokkos::MDRangePolicy<
+    ExecutionSpace,
+    Kokkos::Rank<View::rank,
+                 view_iterate<typename View::array_layout>::value,
+                 view_iterate<typename View::array_layout>::value>>;
+
+// Tile extent of the dimension with the smallest stride and of the dimension
+// with the second smallest stride in policies created by
+// make_view_mdrange_policy. All other dimensions use tiles of extent one. The
+// product stays below the maximum tile size of all Kokkos backends.
+constexpr int view_mdrange_inner_tile = 32;
+constexpr int view_mdrange_outer_tile = 4;
+
+/// Creates a multi-dimensional range policy on the given instance covering
+/// all elements of the view, iterating in the order of the view's layout.
+/// Tiles span view_mdrange_inner_tile elements of the dimension with the
+/// smallest stride and view_mdrange_outer_tile elements of the dimension with
+/// the second smallest stride, so that each tile reads contiguous memory.
+template <typename ExecutionSpace, typename View>
+view_mdrange_policy_t<typename std::decay<ExecutionSpace>::type, View>
+make_view_mdrange_policy(ExecutionSpace &&instance, View const &v) {
+  static_assert(View::rank >= 2,
+                "make_view_mdrange_policy requires a view of rank 2 or higher");
+  static_assert(View::rank <= 6,
+                "Kokkos::MDRangePolicy supports at most rank 6, so "
+                "make_view_mdrange_policy does too");
+
+  using policy_type =
+      view_mdrange_policy_t<typename std::decay<ExecutionSpace>::type, View>;
+  using index_type = typename policy_type::index_type;
+
+  // The dimensions with the smallest and second smallest strides.
+  std::size_t inner = v.stride(1) < v.stride(0) ? 1 : 0;
+  std::size_t outer = 1 - inner;
+  for (std::size_t r = 2; r < View::rank; ++r) {
+    if (v.stride(r) < v.stride(inner)) {
+      outer = inner;
+      inner = r;
+    } else if (v.stride(r) < v.stride(outer)) {
+      outer = r;
+    }
+  }
+
+  typename policy_type::point_type lower{};
+  typename policy_type::point_type upper{};
+  typename policy_type::tile_type tile{};
+  for (std::size_t r = 0; r < View::rank; ++r) {
+    lower[r] = 0;
+    upper[r] = v.extent(r);
+    tile[r] = 1;
+  }
+  tile[inner] = (std::max)(
+      index_type(1),
+      (std::min)(index_type(v.extent(inner)),
+                 index_type(view_mdrange_inner_tile)));
+  tile[outer] = (std::max)(
+      index_type(1),
+      (std::min)(index_type(v.extent(outer)),
+                 index_type(view_mdrange_outer_tile)));
+
+  return policy_type(std::forward<ExecutionSpace>(instance), lower, upper,
+                     tile);
+}
+
+/// Creates a policy on the given instance covering all elements of the view.
+/// Rank 1 views use a range policy, higher ranks a multi-dimensional range
+/// policy.
+template <typename ExecutionSpace, typename View,
+          typename std::enable_if<View::rank == 1, int>::type = 0>
+Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>
+make_view_policy(ExecutionSpace &&instance, View const &v) {
+  return Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>(
+      std::forward<ExecutionSpace>(instance), 0, v.extent(0));
+}
+
+template <typename ExecutionSpace, typename View,
+          typename std::enable_if<(View::rank > 1), int>::type = 0>
+view_mdrange_policy_t<typename std::decay<ExecutionSpace>::type, View>
+make_view_policy(ExecutionSpace &&instance, View const &v) {
+  return make_view_mdrange_policy(std::forward<ExecutionSpace>(instance), v);
+}
+
+template <std::size_t> using view_index_t = std::int64_t;
+} // namespace detail
 } // namespace kokkos
 } // namespace hpx
@@ -0,0 +1,757 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains asynchronous loading of views from binary files and asynchronous
+/// checkpointing of views. Files are memory-mapped where available and
+/// streamed into views chunk by chunk, so that reading from the file overlaps
+/// with copying into the view. Checkpoints are written from HPX threads in
+/// parallel chunks after the views have been copied to staging buffers.
+
+#pragma once
+
+#include <hpx/kokkos/deep_copy.hpp>
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/future.hpp>
+#include <hpx/kokkos/view_pool.hpp>
+
+#include <hpx/future.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HPX_KOKKOS_DETAIL_HAVE_MMAP
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <mutex>
+#endif
+
+namespace hpx {
+namespace kokkos {
+/// The default size of the chunks in which load_view_async copies a file.
+constexpr std::size_t load_view_default_chunk_bytes = std::size_t(64) << 20;
+
+namespace detail {
+#if defined(HPX_KOKKOS_DETAIL_HAVE_MMAP)
+// A read-only memory mapping of a file. Chunks are read ahead with prefetch
+// before they are needed and dropped from memory with release once they have
+// been copied, so that only a few chunks are resident at a time.
+class file_reader {
+public:
+  explicit file_reader(std::string const &path) {
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("hpx::kokkos: could not open " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      throw std::runtime_error("hpx::kokkos: could not stat " + path);
+    }
+    file_size = std::size_t(st.st_size);
+
+    if (file_size > 0) {
+      data = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        ::close(fd);
+        throw std::runtime_error("hpx::kokkos: could not map " + path);
+      }
+      ::madvise(data, file_size, MADV_SEQUENTIAL);
+    }
+  }
+
+  ~file_reader() {
+    if (data != nullptr) {
+      ::munmap(data, file_size);
+    }
+    ::close(fd);
+  }
+
+  file_reader(file_reader const &) = delete;
+  file_reader &operator=(file_reader const &) = delete;
+
+  std::size_t size() const { return file_size; }
+
+  // Returns a pointer to the bytes [offset, offset + bytes) of the file,
+  // valid until release is called for them.
+  char const *read(std::size_t const offset, std::size_t) const {
+    return static_cast<char const *>(data) + offset;
+  }
+
+  // Starts reading the given bytes of the file in the background.
+  void prefetch(std::size_t const offset, std::size_t const bytes) const {
+    advise(offset, bytes, MADV_WILLNEED);
+  }
+
+  void release(std::size_t const offset, std::size_t const bytes) const {
+    advise(offset, bytes, MADV_DONTNEED);
+  }
+
+private:
+  void advise(std::size_t const offset, std::size_t const bytes,
+              int const advice) const {
+    if (bytes == 0) {
+      return;
+    }
+    // madvise requires page-aligned addresses.
+    std::size_t const page_size = std::size_t(::sysconf(_SC_PAGESIZE));
+    std::size_t const begin = offset / page_size * page_size;
+    ::madvise(static_cast<char *>(data) + begin, offset + bytes - begin,
+              advice);
+  }
+
+  int fd = -1;
+  void *data = nullptr;
+  std::size_t file_size = 0;
+};
+
+// A file of a fixed size that can be written from several threads at once.
+// The data is written to a temporary file next to path, which replaces path
+// only when commit is called. Otherwise the temporary file is removed, so
+// that a failed write never leaves a partial file at path.
+class file_writer {
+public:
+  file_writer(std::string const &path, std::size_t const size)
+      : path(path), tmp_path(path + ".tmp") {
+    fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      throw std::runtime_error("hpx::kokkos: could not open " + tmp_path);
+    }
+    if (::ftruncate(fd, off_t(size)) != 0) {
+      ::close(fd);
+      ::unlink(tmp_path.c_str());
+      throw std::runtime_error("hpx::kokkos: could not resize " + tmp_path);
+    }
+  }
+
+  ~file_writer() {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+    if (!committed) {
+      ::unlink(tmp_path.c_str());
+    }
+  }
+
+  file_writer(file_writer const &) = delete;
+  file_writer &operator=(file_writer const &) = delete;
+
+  void write(std::size_t offset, char const *data, std::size_t bytes) {
+    while (bytes > 0) {
+      ssize_t const written = ::pwrite(fd, data, bytes, off_t(offset));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw std::runtime_error("hpx::kokkos: could not write file");
+      }
+      data += written;
+      offset += std::size_t(written);
+      bytes -= std::size_t(written);
+    }
+  }
+
+  // Flushes the data to disk and atomically replaces path with it.
+  void commit() {
+    if (::fsync(fd) != 0) {
+      throw std::runtime_error("hpx::kokkos: could not sync " + tmp_path);
+    }
+    ::close(fd);
+    fd = -1;
+    if (::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      throw std::runtime_error("hpx::kokkos: could not rename " + tmp_path +
+                               " to " + path);
+    }
+    committed = true;
+  }
+
+private:
+  std::string path;
+  std::string tmp_path;
+  int fd = -1;
+  bool committed = false;
+};
+#else
+// Reads chunks of a file into a buffer. Only one chunk is read at a time,
+// into the same buffer.
+class file_reader {
+public:
+  explicit file_reader(std::string const &path)
+      : file(path, std::ios::binary | std::ios::ate) {
+    if (!file) {
+      throw std::runtime_error("hpx::kokkos: could not open " + path);
+    }
+    file_size = std::size_t(file.tellg());
+  }
+
+  std::size_t size() const { return file_size; }
+
+  char const *read(std::size_t const offset, std::size_t const bytes) {
+    buffer.resize(bytes);
+    file.seekg(offset);
+    file.read(buffer.data(), bytes);
+    if (!file) {
+      throw std::runtime_error("hpx::kokkos: could not read file");
+    }
+    return buffer.data();
+  }
+
+  void prefetch(std::size_t, std::size_t) const {}
+  void release(std::size_t, std::size_t) const {}
+
+private:
+  std::ifstream file;
+  std::vector<char> buffer;
+  std::size_t file_size = 0;
+};
+
+// A file that can be written from several threads, one write at a time. As
+// above, the data is written to a temporary file that replaces path on
+// commit.
+class file_writer {
+public:
+  file_writer(std::string const &path, std::size_t)
+      : path(path), tmp_path(path + ".tmp"),
+        file(tmp_path, std::ios::binary | std::ios::trunc) {
+    if (!file) {
+      throw std::runtime_error("hpx::kokkos: could not open " + tmp_path);
+    }
+  }
+
+  ~file_writer() {
+    if (!committed) {
+      file.close();
+      std::remove(tmp_path.c_str());
+    }
+  }
+
+  file_writer(file_writer const &) = delete;
+  file_writer &operator=(file_writer const &) = delete;
+
+  void write(std::size_t const offset, char const *data,
+             std::size_t const bytes) {
+    std::lock_guard<std::mutex> l(mtx);
+    file.seekp(offset);
+    file.write(data, bytes);
+    if (!file) {
+      throw std::runtime_error("hpx::kokkos: could not write file");
+    }
+  }
+
+  // Flushes the data and replaces path with it. rename does not replace
+  // existing files on all platforms, so path is removed first.
+  void commit() {
+    file.close();
+    if (!file) {
+      throw std::runtime_error("hpx::kokkos: could not write " + tmp_path);
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      throw std::runtime_error("hpx::kokkos: could not rename " + tmp_path +
+                               " to " + path);
+    }
+    committed = true;
+  }
+
+private:
+  std::string path;
+  std::string tmp_path;
+  std::mutex mtx;
+  std::ofstream file;
+  bool committed = false;
+};
+#endif
+
+// Copies the chunk [c * chunk_size, (c + 1) * chunk_size) of the file into the
+// span of view, and continues with the next chunk once the copy has completed.
+// The next chunk is read ahead while the current chunk is being copied.
+template <typename ExecutionSpace, typename View>
+hpx::shared_future<void>
+load_view_chunk(std::shared_ptr<file_reader> reader,
+                ExecutionSpace const &instance, View const &view,
+                std::size_t const file_offset, std::size_t const chunk_size,
+                std::size_t const c) {
+  using value_type = typename View::non_const_value_type;
+  using chunk_view_type =
+      Kokkos::View<value_type const *, Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  std::size_t const n = view.span();
+  std::size_t const b = c * chunk_size;
+  std::size_t const e = (std::min)(n, b + chunk_size);
+  std::size_t const offset = file_offset + b * sizeof(value_type);
+  std::size_t const bytes = (e - b) * sizeof(value_type);
+
+  chunk_view_type chunk(
+      reinterpret_cast<value_type const *>(reader->read(offset, bytes)), e - b);
+  reader->prefetch(offset + bytes,
+                   ((std::min)(n, e + chunk_size) - e) * sizeof(value_type));
+
+  return deep_copy_async(instance, flat_subview(view, b, e), chunk)
+      .then(hpx::launch::async,
+            [reader, instance, view, file_offset, chunk_size, c, n, e,
+             offset,
+             bytes](hpx::shared_future<void> &&f) -> hpx::shared_future<void> {
+              f.get();
+              reader->release(offset, bytes);
+              if (e == n) {
+                return hpx::make_ready_future();
+              }
+              return load_view_chunk(std::move(reader), instance, view,
+                                     file_offset, chunk_size, c + 1);
+            });
+}
+} // namespace detail
+
+/// \brief Loads the contents of the binary file at path into view, enqueuing
+/// the copies on instance. The file holds the elements of view in the order
+/// of its span and must be at least view.span() * sizeof(value_type) bytes
+/// large. view must be contiguous. The file is memory-mapped where supported
+/// and copied in chunks of about chunk_bytes: the next chunk is read from the
+/// file while the current chunk is being copied, and chunks are dropped from
+/// memory once copied, so that only about two chunks are resident at a time.
+/// Host views that have been allocated without initialization are first
+/// touched by the copy on instance. Returns a future that becomes ready when
+/// the whole file has been copied. Errors opening the file are thrown
+/// immediately.
+template <typename View, typename ExecutionSpace,
+          typename Enable = typename std::enable_if<
+              Kokkos::is_view<View>::value &&
+              Kokkos::is_execution_space<ExecutionSpace>::value>::type>
+hpx::shared_future<void>
+load_view_async(std::string const &path, View const &view,
+                ExecutionSpace const &instance,
+                std::size_t const chunk_bytes = load_view_default_chunk_bytes) {
+  using value_type = typename View::non_const_value_type;
+  static_assert(std::is_same<typename View::value_type, value_type>::value,
+                "hpx::kokkos::load_view_async requires a non-const view");
+  static_assert(std::is_trivially_copyable<value_type>::value,
+                "hpx::kokkos::load_view_async requires a trivially copyable "
+                "value type");
+
+  if (!view.span_is_contiguous()) {
+    throw std::runtime_error(
+        "hpx::kokkos::load_view_async: view must be contiguous");
+  }
+
+  auto reader = std::make_shared<detail::file_reader>(path);
+  if (reader->size() < view.span() * sizeof(value_type)) {
+    throw std::runtime_error("hpx::kokkos::load_view_async: " + path +
+                             " is smaller than the view");
+  }
+
+  if (view.span() == 0) {
+    return hpx::make_ready_future();
+  }
+
+  std::size_t const chunk_size =
+      (std::max)(std::size_t(1), chunk_bytes / sizeof(value_type));
+  HPX_KOKKOS_DETAIL_LOG("loading %s in chunks of %zu elements", path.c_str(),
+                        chunk_size);
+  return detail::load_view_chunk(std::move(reader), instance, view, 0,
+                                 chunk_size, 0);
+}
+
+/// \brief Like the overload taking an execution space instance, but enqueues
+/// the copies on a default instance of the execution space of view.
+template <typename View, typename Enable = typename std::enable_if<
+                             Kokkos::is_view<View>::value>::type>
+hpx::shared_future<void> load_view_async(std::string const &path,
+                                         View const &view) {
+  return load_view_async(path, view, typename View::execution_space());
+}
+
+namespace detail {
+// Checkpoints start with a fixed-size prefix (magic, format version, number
+// of views, size of the header) followed by one entry per view. The data of
+// each view starts at an offset aligned to checkpoint_alignment. All values
+// are stored in native byte order.
+constexpr char checkpoint_magic[8] = {'H', 'P', 'X', 'K', 'C', 'K', 'P', 'T'};
+constexpr std::uint32_t checkpoint_version = 1;
+constexpr std::size_t checkpoint_prefix_bytes = 8 + 4 + 4 + 8;
+constexpr std::size_t checkpoint_alignment = 4096;
+constexpr std::size_t checkpoint_write_chunk_bytes = std::size_t(16) << 20;
+
+struct checkpoint_entry {
+  std::string label;
+  std::uint32_t value_size = 0;
+  std::vector<std::uint64_t> extents;
+  std::uint64_t offset = 0;
+  std::uint64_t bytes = 0;
+};
+
+template <typename View> checkpoint_entry make_checkpoint_entry(View const &v) {
+  checkpoint_entry entry;
+  entry.label = v.label();
+  entry.value_size = sizeof(typename View::value_type);
+  for (unsigned r = 0; r < View::rank; ++r) {
+    entry.extents.push_back(v.extent(r));
+  }
+  entry.bytes = v.span() * sizeof(typename View::value_type);
+  return entry;
+}
+
+template <typename T> void append_checkpoint_value(std::vector<char> &h, T v) {
+  char const *p = reinterpret_cast<char const *>(&v);
+  h.insert(h.end(), p, p + sizeof(T));
+}
+
+// Assigns the data offsets of the entries and returns the serialized header.
+inline std::vector<char>
+make_checkpoint_header(std::vector<checkpoint_entry> &entries) {
+  std::size_t header_bytes = checkpoint_prefix_bytes;
+  for (auto const &entry : entries) {
+    header_bytes += 4 + entry.label.size() + 4 + 4 +
+                    8 * entry.extents.size() + 8 + 8;
+  }
+
+  std::uint64_t offset = header_bytes;
+  for (auto &entry : entries) {
+    offset = (offset + checkpoint_alignment - 1) / checkpoint_alignment *
+             checkpoint_alignment;
+    entry.offset = offset;
+    offset += entry.bytes;
+  }
+
+  std::vector<char> h(checkpoint_magic, checkpoint_magic + 8);
+  h.reserve(header_bytes);
+  append_checkpoint_value(h, checkpoint_version);
+  append_checkpoint_value(h, std::uint32_t(entries.size()));
+  append_checkpoint_value(h, std::uint64_t(header_bytes));
+  for (auto const &entry : entries) {
+    append_checkpoint_value(h, std::uint32_t(entry.label.size()));
+    h.insert(h.end(), entry.label.begin(), entry.label.end());
+    append_checkpoint_value(h, entry.value_size);
+    append_checkpoint_value(h, std::uint32_t(entry.extents.size()));
+    for (auto const extent : entry.extents) {
+      append_checkpoint_value(h, extent);
+    }
+    append_checkpoint_value(h, entry.offset);
+    append_checkpoint_value(h, entry.bytes);
+  }
+
+  return h;
+}
+
+// Reads values from a serialized header, checking that they are in bounds.
+class checkpoint_header_reader {
+public:
+  checkpoint_header_reader(char const *data, std::size_t const size)
+      : data(data), size(size) {}
+
+  template <typename T> T read() {
+    T v;
+    std::memcpy(&v, read_bytes(sizeof(T)), sizeof(T));
+    return v;
+  }
+
+  char const *read_bytes(std::size_t const bytes) {
+    if (bytes > size - offset) {
+      throw std::runtime_error("hpx::kokkos: truncated checkpoint header");
+    }
+    char const *p = data + offset;
+    offset += bytes;
+    return p;
+  }
+
+private:
+  char const *data;
+  std::size_t size;
+  std::size_t offset = 0;
+};
+
+inline std::vector<checkpoint_entry>
+read_checkpoint_header(file_reader &reader, std::string const &path) {
+  if (reader.size() < checkpoint_prefix_bytes) {
+    throw std::runtime_error("hpx::kokkos: " + path + " is not a checkpoint");
+  }
+
+  checkpoint_header_reader prefix(
+      reader.read(0, checkpoint_prefix_bytes), checkpoint_prefix_bytes);
+  if (std::memcmp(prefix.read_bytes(8), checkpoint_magic, 8) != 0) {
+    throw std::runtime_error("hpx::kokkos: " + path + " is not a checkpoint");
+  }
+  if (prefix.read<std::uint32_t>() != checkpoint_version) {
+    throw std::runtime_error("hpx::kokkos: unsupported checkpoint version in " +
+                             path);
+  }
+  std::uint32_t const num_views = prefix.read<std::uint32_t>();
+  std::uint64_t const header_bytes = prefix.read<std::uint64_t>();
+  if (header_bytes > reader.size()) {
+    throw std::runtime_error("hpx::kokkos: truncated checkpoint " + path);
+  }
+
+  checkpoint_header_reader header(reader.read(0, header_bytes), header_bytes);
+  header.read_bytes(checkpoint_prefix_bytes);
+  std::vector<checkpoint_entry> entries(num_views);
+  for (auto &entry : entries) {
+    std::uint32_t const label_size = header.read<std::uint32_t>();
+    char const *label = header.read_bytes(label_size);
+    entry.label.assign(label, label + label_size);
+    entry.value_size = header.read<std::uint32_t>();
+    entry.extents.resize(header.read<std::uint32_t>());
+    for (auto &extent : entry.extents) {
+      extent = header.read<std::uint64_t>();
+    }
+    entry.offset = header.read<std::uint64_t>();
+    entry.bytes = header.read<std::uint64_t>();
+    if (entry.offset + entry.bytes > reader.size()) {
+      throw std::runtime_error("hpx::kokkos: truncated checkpoint " + path);
+    }
+  }
+
+  return entries;
+}
+
+template <typename View>
+void check_checkpoint_entry(checkpoint_entry const &entry, View const &view) {
+  bool matches = entry.value_size == sizeof(typename View::value_type) &&
+                 entry.extents.size() == View::rank;
+  for (unsigned r = 0; matches && r < View::rank; ++r) {
+    matches = entry.extents[r] == view.extent(r);
+  }
+  if (!matches) {
+    throw std::runtime_error("hpx::kokkos::restore_async: view " +
+                             view.label() +
+                             " does not match the checkpointed view " +
+                             entry.label);
+  }
+}
+
+// A snapshot of a view in a staging buffer from the host view_pool. The
+// buffer is returned to the pool when the last copy of block is destroyed.
+struct checkpoint_staging {
+  std::shared_ptr<void> block;
+  std::uint64_t offset;
+  std::size_t bytes;
+};
+
+template <typename ExecutionSpace, typename View>
+checkpoint_staging stage_checkpoint_view(ExecutionSpace const &instance,
+                                         View const &view,
+                                         checkpoint_entry const &entry) {
+  using value_type = typename View::non_const_value_type;
+  using staging_view_type =
+      Kokkos::View<value_type *, Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  auto &pool = view_pool<Kokkos::HostSpace>::get();
+  std::size_t block_bytes = entry.bytes;
+  void *p = pool.try_acquire(block_bytes);
+  if (p == nullptr) {
+    p = pool.allocate("checkpoint_staging", block_bytes);
+  }
+  std::shared_ptr<void> block(p, [block_bytes](void *q) {
+    view_pool<Kokkos::HostSpace>::get().release(q, block_bytes,
+                                                hpx::make_ready_future());
+  });
+
+  Kokkos::deep_copy(instance,
+                    staging_view_type(static_cast<value_type *>(p),
+                                      view.span()),
+                    flat_subview(view, 0, view.span()));
+  return {std::move(block), entry.offset, std::size_t(entry.bytes)};
+}
+
+// Writes the header and the staged views in chunks from separate HPX threads,
+// and commits the file once all chunks have been written.
+inline hpx::shared_future<void>
+write_checkpoint(std::shared_ptr<file_writer> writer,
+                 std::shared_ptr<std::vector<char>> header,
+                 std::vector<checkpoint_staging> staging) {
+  std::vector<hpx::shared_future<void>> writes;
+  writes.push_back(hpx::async([writer, header]() {
+    writer->write(0, header->data(), header->size());
+  }));
+  for (auto const &s : staging) {
+    for (std::size_t b = 0; b < s.bytes; b += checkpoint_write_chunk_bytes) {
+      char const *data = static_cast<char const *>(s.block.get()) + b;
+      std::size_t const bytes =
+          (std::min)(checkpoint_write_chunk_bytes, s.bytes - b);
+      writes.push_back(
+          hpx::async([writer, data, offset = s.offset + b, bytes]() {
+            writer->write(offset, data, bytes);
+          }));
+    }
+  }
+
+  return hpx::when_all(std::move(writes))
+      .then(hpx::launch::sync,
+            [writer = std::move(writer), staging = std::move(staging)](
+                hpx::future<std::vector<hpx::shared_future<void>>>
+                    &&f) mutable {
+              // Return the staging buffers to the pool before reporting
+              // errors. If a write failed, the temporary file is removed
+              // when file goes out of scope and path is left unchanged.
+              auto writes = f.get();
+              staging.clear();
+              auto const file = std::move(writer);
+              for (auto &w : writes) {
+                w.get();
+              }
+              file->commit();
+            });
+}
+} // namespace detail
+
+/// \brief Writes a checkpoint of views to the file at path. The views are
+/// first copied to staging buffers in host memory with copies enqueued on
+/// instance. Work enqueued on instance after this call may modify the views
+/// right away, since it runs after the copies. Once the copies have completed
+/// the staging buffers are written to the file from HPX threads in parallel
+/// chunks. The staging buffers come from the host view_pool and are reused
+/// by later checkpoints. The data is written to path + ".tmp", which is synced
+/// to disk and renamed to path once all data has been written, so that path
+/// always holds either the previous or the new checkpoint. Returns a future
+/// that becomes ready when the file has been written.
+///
+/// The file is self-describing: it stores the label, value size, extents, and
+/// data of each view in the order of its span. All views must be contiguous
+/// and have trivially copyable value types. Checkpoints are read back with
+/// restore_async.
+template <typename ExecutionSpace, typename... Views,
+          typename Enable = typename std::enable_if<
+              Kokkos::is_execution_space<ExecutionSpace>::value>::type>
+hpx::shared_future<void> checkpoint_async(ExecutionSpace const &instance,
+                                          std::string const &path,
+                                          Views const &...views) {
+  static_assert((Kokkos::is_view<Views>::value && ...),
+                "hpx::kokkos::checkpoint_async requires views");
+  static_assert(
+      (std::is_trivially_copyable<
+           typename Views::non_const_value_type>::value &&
+       ...),
+      "hpx::kokkos::checkpoint_async requires trivially copyable value types");
+
+  if (!(views.span_is_contiguous() && ...)) {
+    throw std::runtime_error(
+        "hpx::kokkos::checkpoint_async: views must be contiguous");
+  }
+
+  std::vector<detail::checkpoint_entry> entries{
+      detail::make_checkpoint_entry(views)...};
+  auto header = std::make_shared<std::vector<char>>(
+      detail::make_checkpoint_header(entries));
+  std::size_t const file_size =
+      entries.empty()
+          ? header->size()
+          : std::size_t(entries.back().offset + entries.back().bytes);
+  auto writer = std::make_shared<detail::file_writer>(path, file_size);
+
+  std::vector<detail::checkpoint_staging> staging;
+  staging.reserve(sizeof...(Views));
+  std::size_t k = 0;
+  (staging.push_back(
+       detail::stage_checkpoint_view(instance, views, entries[k++])),
+   ...);
+  HPX_KOKKOS_DETAIL_LOG("checkpointing %zu views to %s", entries.size(),
+                        path.c_str());
+
+  return detail::get_future<ExecutionSpace>::call(instance).then(
+      hpx::launch::async,
+      [writer = std::move(writer), header = std::move(header),
+       staging = std::move(staging)](
+          hpx::shared_future<void> &&f) mutable -> hpx::shared_future<void> {
+        f.get();
+        return detail::write_checkpoint(std::move(writer), std::move(header),
+                                        std::move(staging));
+      });
+}
+
+/// \brief Like the overload taking an execution space instance, but enqueues
+/// the copies on a default instance of Kokkos::DefaultExecutionSpace.
+template <typename... Views>
+hpx::shared_future<void> checkpoint_async(std::string const &path,
+                                          Views const &...views) {
+  return checkpoint_async(Kokkos::DefaultExecutionSpace(), path, views...);
+}
+
+/// \brief Restores views from a checkpoint written by checkpoint_async. The
+/// views must be given in the same order as to checkpoint_async and have the
+/// same value sizes and extents, otherwise an exception is thrown. The file is
+/// memory-mapped and streamed into the views one after the other as by
+/// load_view_async, with copies enqueued on instance. Returns a future that
+/// becomes ready when all views have been restored.
+template <typename ExecutionSpace, typename... Views,
+          typename Enable = typename std::enable_if<
+              Kokkos::is_execution_space<ExecutionSpace>::value>::type>
+hpx::shared_future<void> restore_async(ExecutionSpace const &instance,
+                                       std::string const &path,
+                                       Views const &...views) {
+  static_assert((Kokkos::is_view<Views>::value && ...),
+                "hpx::kokkos::restore_async requires views");
+  static_assert((std::is_same<typename Views::value_type,
+                              typename Views::non_const_value_type>::value &&
+                 ...),
+                "hpx::kokkos::restore_async requires non-const views");
+
+  if (!(views.span_is_contiguous() && ...)) {
+    throw std::runtime_error(
+        "hpx::kokkos::restore_async: views must be contiguous");
+  }
+
+  auto reader = std::make_shared<detail::file_reader>(path);
+  auto const entries = detail::read_checkpoint_header(*reader, path);
+  if (entries.size() != sizeof...(Views)) {
+    throw std::runtime_error("hpx::kokkos::restore_async: " + path +
+                             " holds a different number of views");
+  }
+  std::size_t k = 0;
+  (detail::check_checkpoint_entry(entries[k++], views), ...);
+
+  // The views are restored one after the other, so that only a few chunks of
+  // the file are resident at a time.
+  std::vector<std::function<hpx::shared_future<void>()>> loads;
+  k = 0;
+  (loads.push_back([reader, instance, views, offset = entries[k++].offset]() {
+     std::size_t const chunk_size = (std::max)(
+         std::size_t(1), load_view_default_chunk_bytes /
+                             sizeof(typename Views::value_type));
+     return detail::load_view_chunk(reader, instance, views, offset,
+                                    chunk_size, 0);
+   }),
+   ...);
+
+  hpx::shared_future<void> f = hpx::make_ready_future();
+  for (auto &load : loads) {
+    f = f.then(hpx::launch::sync,
+               [load = std::move(load)](hpx::shared_future<void> &&prev) {
+                 prev.get();
+                 return load();
+               });
+  }
+  return f;
+}
+
+/// \brief Like the overload taking an execution space instance, but enqueues
+/// the copies on a default instance of Kokkos::DefaultExecutionSpace.
+template <typename... Views>
+hpx::shared_future<void> restore_async(std::string const &path,
+                                       Views const &...views) {
+  return restore_async(Kokkos::DefaultExecutionSpace(), path, views...);
+}
+} // namespace kokkos
+} // namespace hpx
+
+#undef HPX_KOKKOS_DETAIL_HAVE_MMAP
@@ -0,0 +1,294 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Contains asynchronous view allocation backed by a per-memory-space pool.
+/// Blocks are recycled instead of being returned to the system allocator.
+/// A block is only reused once the work enqueued on the instance that last
+/// used it has completed, so releasing a block never blocks.
+
+#pragma once
+
+#include <hpx/kokkos/detail/logging.hpp>
+#include <hpx/kokkos/future.hpp>
+
+#include <hpx/future.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+namespace kokkos {
+/// Counters of a view_pool.
+struct view_pool_statistics {
+  /// Number of blocks allocated from the memory space.
+  std::size_t num_allocations = 0;
+  /// Number of blocks handed out again after being released to the pool.
+  std::size_t num_reuses = 0;
+  /// Total number of bytes allocated from the memory space.
+  std::size_t allocated_bytes = 0;
+  /// Number of released blocks waiting for work to complete before they can
+  /// be reused.
+  std::size_t num_pending_blocks = 0;
+};
+
+/// \brief A pool of memory blocks in MemorySpace. Block sizes are rounded up
+/// to powers of two. Released blocks are kept until the future given on
+/// release is ready, after which they can be reused. All blocks are returned
+/// to the memory space when Kokkos is finalized, or explicitly with
+/// release_unused.
+template <typename MemorySpace> class view_pool {
+public:
+  using memory_space = MemorySpace;
+
+  static view_pool &get() {
+    static view_pool pool;
+    return pool;
+  }
+
+  view_pool(view_pool const &) = delete;
+  view_pool &operator=(view_pool const &) = delete;
+
+  /// Returns a free block of at least the given size, or nullptr if no free
+  /// block is available. The size is updated to the size of the block.
+  void *try_acquire(std::size_t &bytes) {
+    bytes = get_block_size(bytes);
+
+    std::lock_guard<std::mutex> l(mtx);
+    collect_ready_blocks();
+    auto &blocks = free_blocks[bytes];
+    if (blocks.empty()) {
+      return nullptr;
+    }
+
+    void *p = blocks.back();
+    blocks.pop_back();
+    ++stats.num_reuses;
+    HPX_KOKKOS_DETAIL_LOG("reusing pooled block %p of size %zu", p, bytes);
+    return p;
+  }
+
+  /// Allocates a new block from the memory space. Blocks allocated with this
+  /// function must be given back with release.
+  void *allocate(std::string const &label, std::size_t &bytes) {
+    bytes = get_block_size(bytes);
+    void *p = memory_space().allocate(label.c_str(), bytes);
+
+    std::lock_guard<std::mutex> l(mtx);
+    ++stats.num_allocations;
+    stats.allocated_bytes += bytes;
+    HPX_KOKKOS_DETAIL_LOG("allocated pooled block %p of size %zu", p, bytes);
+    return p;
+  }
+
+  /// Gives a block back to the pool. The block is reused only once ready is
+  /// ready. Does not block.
+  void release(void *p, std::size_t const bytes,
+               hpx::shared_future<void> ready) {
+    std::lock_guard<std::mutex> l(mtx);
+    if (ready.is_ready()) {
+      free_blocks[bytes].push_back(p);
+    } else {
+      pending_blocks.push_back({p, bytes, std::move(ready)});
+    }
+  }
+
+  /// Returns all free blocks to the memory space. Blocks that are still in
+  /// use or waiting for work to complete are kept.
+  void release_unused() {
+    std::lock_guard<std::mutex> l(mtx);
+    collect_ready_blocks();
+    deallocate_free_blocks();
+  }
+
+  view_pool_statistics statistics() {
+    std::lock_guard<std::mutex> l(mtx);
+    collect_ready_blocks();
+    stats.num_pending_blocks = pending_blocks.size();
+    return stats;
+  }
+
+private:
+  struct pending_block {
+    void *p;
+    std::size_t bytes;
+    hpx::shared_future<void> ready;
+  };
+
+  // Blocks can not be deallocated once Kokkos has been finalized, so all
+  // blocks owned by the pool are deallocated in a finalize hook.
+  view_pool() {
+    Kokkos::push_finalize_hook([this]() {
+      Kokkos::fence();
+      std::lock_guard<std::mutex> l(mtx);
+      for (auto &b : pending_blocks) {
+        // Fences on separate HPX threads (see get_release_future) may still
+        // be in progress.
+        b.ready.wait();
+        free_blocks[b.bytes].push_back(b.p);
+      }
+      pending_blocks.clear();
+      deallocate_free_blocks();
+    });
+  }
+
+  static std::size_t get_block_size(std::size_t const bytes) {
+    std::size_t block_size = min_block_size;
+    while (block_size < bytes) {
+      block_size *= 2;
+    }
+    return block_size;
+  }
+
+  void collect_ready_blocks() {
+    auto it = pending_blocks.begin();
+    while (it != pending_blocks.end()) {
+      if (it->ready.is_ready()) {
+        free_blocks[it->bytes].push_back(it->p);
+        it = pending_blocks.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  void deallocate_free_blocks() {
+    for (auto &blocks : free_blocks) {
+      for (void *p : blocks.second) {
+        memory_space().deallocate(p, blocks.first);
+        stats.allocated_bytes -= blocks.first;
+      }
+      blocks.second.clear();
+    }
+  }
+
+  static constexpr std::size_t min_block_size = 256;
+
+  std::mutex mtx;
+  std::unordered_map<std::size_t, std::vector<void *>> free_blocks;
+  std::vector<pending_block> pending_blocks;
+  view_pool_statistics stats;
+};
+
+/// \brief An unmanaged view whose memory comes from a view_pool. The memory
+/// is given back to the pool when the last copy of the pooled_view is
+/// destroyed. It is reused only after the work enqueued on the allocating
+/// instance up to that point has completed.
+///
+/// The view returned by view() is unmanaged: it and its copies (including
+/// copies captured by kernels) do not keep the memory alive. The pooled_view
+/// must be kept alive until all work using the view has been enqueued on the
+/// allocating instance. Work on other instances must additionally keep the
+/// pooled_view alive until it has completed, e.g. with keep_alive.
+template <typename View> class pooled_view {
+public:
+  using view_type = View;
+
+  pooled_view() = default;
+  pooled_view(View v, std::shared_ptr<void> block)
+      : v(std::move(v)), block(std::move(block)) {}
+
+  /// Returns the unmanaged view. The view does not own its memory, see
+  /// pooled_view.
+  View const &view() const { return v; }
+  /// \copydoc view
+  operator View const &() const { return v; }
+
+  long use_count() const { return block.use_count(); }
+
+private:
+  View v;
+  std::shared_ptr<void> block;
+};
+
+namespace detail {
+// Returns a future that becomes ready when the work enqueued on instance has
+// completed. Instances without an asynchronous completion mechanism are
+// fenced on a separate HPX thread, so that destroying the last copy of a
+// pooled_view never blocks.
+template <typename ExecutionSpace>
+hpx::shared_future<void> get_release_future(ExecutionSpace const &instance) {
+  if constexpr (has_async_get_future<ExecutionSpace>::value) {
+    return get_future<ExecutionSpace>::call(instance);
+  } else {
+    return hpx::async(
+        [instance]() { get_future<ExecutionSpace>::call(instance).get(); });
+  }
+}
+
+template <typename DataType, typename ExecutionSpace>
+using pooled_view_t =
+    Kokkos::View<DataType, typename ExecutionSpace::memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+template <typename DataType, typename ExecutionSpace>
+pooled_view<pooled_view_t<DataType, ExecutionSpace>>
+make_pooled_view(ExecutionSpace const &instance, void *p,
+                 std::size_t const bytes,
+                 pooled_view_t<DataType, ExecutionSpace> const &v) {
+  using memory_space = typename ExecutionSpace::memory_space;
+
+  std::shared_ptr<void> block(p, [instance, bytes](void *q) {
+    view_pool<memory_space>::get().release(q, bytes,
+                                           get_release_future(instance));
+  });
+
+  return {v, std::move(block)};
+}
+} // namespace detail
+
+/// \brief Allocates a view of the given data type (e.g. double**) and extents
+/// in the memory space of instance, using memory from a view_pool. The view
+/// is value-initialized on instance. Returns a future to a pooled_view,
+/// which becomes ready once the view has been initialized. If no block of a
+/// suitable size is free, a new block is allocated from the memory space on
+/// a separate HPX thread so that the caller is not blocked.
+template <typename DataType, typename ExecutionSpace, typename... Extents>
+hpx::shared_future<pooled_view<detail::pooled_view_t<DataType, ExecutionSpace>>>
+make_view_async(ExecutionSpace const &instance, std::string const &label,
+                Extents... extents) {
+  using memory_space = typename ExecutionSpace::memory_space;
+  using view_type = detail::pooled_view_t<DataType, ExecutionSpace>;
+  using value_type = typename view_type::non_const_value_type;
+  using pooled_view_type = pooled_view<view_type>;
+
+  std::size_t const required_bytes =
+      view_type::required_allocation_size(std::size_t(extents)...);
+
+  auto initialize = [instance, extents...](void *p, std::size_t const bytes) {
+    view_type v(static_cast<value_type *>(p), std::size_t(extents)...);
+    auto pv = detail::make_pooled_view<DataType>(instance, p, bytes, v);
+    Kokkos::deep_copy(instance, v, value_type{});
+    return detail::get_future<ExecutionSpace>::call(instance).then(
+        hpx::launch::sync,
+        [pv](hpx::shared_future<void> &&f) -> pooled_view_type {
+          f.get();
+          return pv;
+        });
+  };
+
+  std::size_t bytes = required_bytes;
+  if (void *p = view_pool<memory_space>::get().try_acquire(bytes)) {
+    return initialize(p, bytes);
+  }
+
+  // The outer future returned by async is unwrapped.
+  return hpx::future<pooled_view_type>(
+      hpx::async([label, required_bytes, initialize]() {
+        std::size_t bytes = required_bytes;
+        void *p = view_pool<memory_space>::get().allocate(label, bytes);
+        return initialize(p, bytes);
+      }));
+}
+} // namespace kokkos
+} // namespace hpx
@@ -0,0 +1,180 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests polling an event source with an adaptive_poller.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+// An event source whose events complete when the test marks them as ready.
+struct mock_event_source {
+  std::shared_ptr<std::atomic<std::size_t>> ready =
+      std::make_shared<std::atomic<std::size_t>>(0);
+
+  std::size_t poll() { return ready->exchange(0); }
+};
+
+void test_adaptive_polling_manual() {
+  hpx::kokkos::adaptive_polling_parameters parameters;
+  parameters.min_interval = 1;
+  parameters.max_interval = 16;
+  parameters.use_polling_thread = false;
+
+  hpx::kokkos::adaptive_poller<mock_event_source> poller(mock_event_source(),
+                                                         parameters);
+  auto ready = poller.source().ready;
+
+  // Nothing is polled while no events are outstanding.
+  for (int i = 0; i < 100; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(poller.poll() == 0);
+  }
+  auto stats = poller.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats.num_iterations == 100);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_idle_iterations == 100);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_polls == 0);
+
+  // Empty polls back off up to the maximum interval.
+  poller.add_outstanding(2);
+  HPX_KOKKOS_DETAIL_TEST(poller.outstanding() == 2);
+  for (int i = 0; i < 1000; ++i) {
+    poller.poll();
+  }
+  stats = poller.statistics();
+  HPX_KOKKOS_DETAIL_TEST(poller.interval() == parameters.max_interval);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_polls == stats.num_empty_polls);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_polls < 1000 / parameters.max_interval + 5);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_backoff_iterations > 0);
+  HPX_KOKKOS_DETAIL_TEST(stats.poll_fraction() < 0.1);
+
+  // Completions are picked up within one interval and reset the interval.
+  ready->store(1);
+  std::size_t iterations = 0;
+  while (poller.outstanding() == 2) {
+    poller.poll();
+    ++iterations;
+  }
+  HPX_KOKKOS_DETAIL_TEST(iterations <= parameters.max_interval);
+  HPX_KOKKOS_DETAIL_TEST(poller.interval() == parameters.min_interval);
+  HPX_KOKKOS_DETAIL_TEST(poller.statistics().num_completions == 1);
+
+  ready->store(1);
+  while (poller.outstanding() > 0) {
+    poller.poll();
+  }
+  HPX_KOKKOS_DETAIL_TEST(poller.statistics().num_completions == 2);
+
+  // Events that will not complete can be unregistered.
+  poller.add_outstanding(3);
+  poller.remove_outstanding(3);
+  HPX_KOKKOS_DETAIL_TEST(poller.outstanding() == 0);
+
+  bool caught = false;
+  try {
+    hpx::kokkos::adaptive_polling_parameters invalid;
+    invalid.min_interval = 8;
+    invalid.max_interval = 4;
+    hpx::kokkos::adaptive_poller<mock_event_source> p(mock_event_source(),
+                                                      invalid);
+  } catch (std::invalid_argument const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+}
+
+void test_adaptive_polling_thread() {
+  hpx::kokkos::adaptive_poller<mock_event_source> poller;
+  auto ready = poller.source().ready;
+
+  poller.add_outstanding(3);
+  auto f = hpx::async([ready]() {
+    for (int i = 0; i < 3; ++i) {
+      hpx::this_thread::yield();
+      ready->fetch_add(1);
+    }
+  });
+  f.get();
+
+  // The polling thread completes the events without explicit polls.
+  while (poller.outstanding() > 0) {
+    hpx::this_thread::yield();
+  }
+  HPX_KOKKOS_DETAIL_TEST(poller.statistics().num_completions == 3);
+
+  // The polling thread exits once no events are outstanding, so the counters
+  // eventually stop increasing.
+  auto stats = poller.statistics();
+  for (int i = 0; i < 100; ++i) {
+    hpx::this_thread::yield();
+    auto const next = poller.statistics();
+    if (next.num_iterations == stats.num_iterations) {
+      break;
+    }
+    stats = next;
+  }
+  for (int i = 0; i < 100; ++i) {
+    hpx::this_thread::yield();
+  }
+  HPX_KOKKOS_DETAIL_TEST(poller.statistics().num_iterations ==
+                         stats.num_iterations);
+}
+
+void test_adaptive_polling_thread_backoff() {
+  hpx::kokkos::adaptive_polling_parameters parameters;
+  parameters.max_interval = 16;
+  parameters.backoff_sleep = std::chrono::microseconds(100);
+
+  hpx::kokkos::adaptive_poller<mock_event_source> poller(mock_event_source(),
+                                                         parameters);
+  auto ready = poller.source().ready;
+
+  // While no event completes the polling thread suspends between polls
+  // instead of spinning. At the maximum interval it polls at most once every
+  // 1.5 ms, i.e. about 33 times in 50 ms after backing off.
+  poller.add_outstanding();
+  hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+  auto const stats = poller.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats.num_polls > 0);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_polls < 100);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_backoff_iterations > 0);
+  HPX_KOKKOS_DETAIL_TEST(poller.outstanding() == 1);
+
+  ready->store(1);
+  while (poller.outstanding() > 0) {
+    hpx::this_thread::yield();
+  }
+  HPX_KOKKOS_DETAIL_TEST(poller.statistics().num_completions == 1);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_adaptive_polling_manual();
+    test_adaptive_polling_thread();
+    test_adaptive_polling_thread_backoff();
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,149 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests HPX parallel algorithms split between two execution spaces using the
+/// co-execution executor. Only host execution spaces are paired so that the
+/// data is accessible from both sides.
+
+#include "test.hpp"
+
+#include <hpx/algorithm.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+#include <hpx/numeric.hpp>
+
+#include <cmath>
+
+// Drives the split ratio with synthetic completion times.
+void test_execution_state() {
+  auto const equal = [](double const a, double const b) {
+    return std::abs(a - b) < 1e-9;
+  };
+
+  hpx::kokkos::detail::co_execution_state state(0.5);
+
+  // Equal throughput on both sides keeps the split.
+  state.update(500, 1.0, 500, 1.0);
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.5));
+
+  // With a device four times as fast as the host the balanced host fraction
+  // is 0.2. The split moves halfway towards it with each update.
+  state.update(500, 1.0, 500, 0.25);
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.35));
+  state.update(100, 1.0, 400, 1.0);
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.275));
+  for (int i = 0; i < 50; ++i) {
+    state.update(100, 1.0, 400, 1.0);
+  }
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.2));
+
+  // Empty parts and missing timings do not change the split.
+  state.update(0, 1.0, 500, 1.0);
+  state.update(500, 1.0, 0, 1.0);
+  state.update(500, 0.0, 500, 1.0);
+  state.update(500, 1.0, 500, 0.0);
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.2));
+
+  // A faster host moves the split towards the host.
+  for (int i = 0; i < 50; ++i) {
+    state.update(300, 1.0, 100, 1.0);
+  }
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.75));
+
+  // Both sides keep some work, even if one side is much slower.
+  for (int i = 0; i < 50; ++i) {
+    state.update(1, 1000.0, 1000, 1.0);
+  }
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.01));
+  for (int i = 0; i < 50; ++i) {
+    state.update(1000, 1.0, 1, 1000.0);
+  }
+  HPX_KOKKOS_DETAIL_TEST(equal(state.get_host_fraction(), 0.99));
+
+  HPX_KOKKOS_DETAIL_TEST(
+      equal(hpx::kokkos::detail::co_execution_state(0.0).get_host_fraction(),
+            0.01));
+  HPX_KOKKOS_DETAIL_TEST(
+      equal(hpx::kokkos::detail::co_execution_state(1.0).get_host_fraction(),
+            0.99));
+}
+
+template <typename HostExecutionSpace, typename DeviceExecutionSpace>
+void test(double const initial_host_fraction) {
+  // Algorithms that do not split their range only accept single instances.
+  static_assert(!hpx::kokkos::detail::is_single_instance<
+                    hpx::kokkos::co_instances<HostExecutionSpace,
+                                              DeviceExecutionSpace>>::value,
+                "co_instances are not single instances");
+
+  hpx::kokkos::co_executor<HostExecutionSpace, DeviceExecutionSpace> exec(
+      initial_host_fraction);
+
+  int const n = 10000;
+  Kokkos::View<int *, Kokkos::HostSpace> data("data", n);
+
+  for (int repetition = 0; repetition < 5; ++repetition) {
+    hpx::for_each(
+        hpx::kokkos::kok.on(exec).label("co-execution for_each sync"),
+        data.data(), data.data() + data.size(), KOKKOS_LAMBDA(int &x) {
+          x = 1;
+        });
+
+    auto f = hpx::experimental::for_loop(
+        hpx::kokkos::kok(hpx::execution::task)
+            .on(exec)
+            .label("co-execution for_loop task"),
+        0, n, KOKKOS_LAMBDA(int i) { data(i) += i; });
+    f.get();
+
+    for (int i = 0; i < n; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(data(i) == i + 1);
+    }
+
+    int const offset = -3;
+    int result = hpx::reduce(
+        hpx::kokkos::kok.on(exec).label("co-execution reduce sync"),
+        data.data(), data.data() + data.size(), offset,
+        KOKKOS_LAMBDA(int x, int y) { return x + y; });
+    HPX_KOKKOS_DETAIL_TEST(result == offset + (n * (n + 1)) / 2);
+
+    HPX_KOKKOS_DETAIL_TEST(exec.host_fraction() > 0.0);
+    HPX_KOKKOS_DETAIL_TEST(exec.host_fraction() < 1.0);
+  }
+
+  exec.get_future().get();
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_execution_state();
+    test<Kokkos::DefaultHostExecutionSpace, Kokkos::DefaultHostExecutionSpace>(
+        0.5);
+#if defined(KOKKOS_ENABLE_SERIAL) && defined(KOKKOS_ENABLE_HPX)
+    test<Kokkos::Serial, Kokkos::Experimental::HPX>(0.5);
+    test<Kokkos::Serial, Kokkos::Experimental::HPX>(0.0);
+    test<Kokkos::Serial, Kokkos::Experimental::HPX>(1.0);
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP) && defined(KOKKOS_ENABLE_HPX)
+    test<Kokkos::OpenMP, Kokkos::Experimental::HPX>(0.5);
+#endif
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,379 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests asynchronous deep copies.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template <typename ExecutionSpace>
+void test_deep_copy_chunked(ExecutionSpace &&inst) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+
+  int const n = 1000;
+  int const m = 3;
+
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> src_host("src_host",
+                                                                  n);
+  Kokkos::View<int *, execution_space> dst("dst", n);
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> dst_host("dst_host",
+                                                                  n);
+  for (int i = 0; i < n; ++i) {
+    src_host(i) = i;
+  }
+
+  // Each chunk has its own future.
+  auto futures = hpx::kokkos::deep_copy_chunked_async(inst, dst, src_host, 7);
+  HPX_KOKKOS_DETAIL_TEST(futures.size() == 7);
+  std::size_t covered = 0;
+  for (std::size_t c = 0; c < futures.size(); ++c) {
+    futures[c].get();
+    auto const bounds = hpx::kokkos::get_chunk_bounds(n, futures.size(), c);
+    HPX_KOKKOS_DETAIL_TEST(bounds.first == covered);
+    covered = bounds.second;
+  }
+  HPX_KOKKOS_DETAIL_TEST(covered == n);
+
+  // The callback is called once per chunk with its bounds.
+  std::atomic<std::size_t> num_copied(0);
+  hpx::kokkos::deep_copy_chunked_async(
+      inst, dst_host, dst, 4,
+      [&](std::size_t const b, std::size_t const e) { num_copied += e - b; })
+      .get();
+  HPX_KOKKOS_DETAIL_TEST(num_copied == n);
+  for (int i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(dst_host(i) == i);
+  }
+
+  // Views of higher rank are split into pieces of their span.
+  Kokkos::View<int **, Kokkos::LayoutRight, Kokkos::HostSpace> src_2d_host(
+      "src_2d_host", n, m);
+  Kokkos::View<int **, Kokkos::LayoutRight, Kokkos::HostSpace> dst_2d_host(
+      "dst_2d_host", n, m);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < m; ++j) {
+      src_2d_host(i, j) = i * m + j;
+    }
+  }
+  auto const futures_2d = hpx::kokkos::deep_copy_chunked_async(
+      Kokkos::DefaultHostExecutionSpace{}, dst_2d_host, src_2d_host, 5);
+  for (auto const &f : futures_2d) {
+    f.get();
+  }
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < m; ++j) {
+      HPX_KOKKOS_DETAIL_TEST(dst_2d_host(i, j) == i * m + j);
+    }
+  }
+
+  // More chunks than elements and empty views are allowed.
+  Kokkos::View<int *, execution_space> small("small", 2);
+  HPX_KOKKOS_DETAIL_TEST(
+      hpx::kokkos::deep_copy_chunked_async(
+          inst, small, Kokkos::subview(src_host, Kokkos::make_pair(0, 2)), 8)
+          .size() == 2);
+  Kokkos::View<int *, execution_space> empty("empty", 0);
+  HPX_KOKKOS_DETAIL_TEST(
+      hpx::kokkos::deep_copy_chunked_async(inst, empty, empty, 8).empty());
+
+  // Zero chunks are rejected.
+  bool caught = false;
+  try {
+    hpx::kokkos::deep_copy_chunked_async(inst, dst, src_host, 0);
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+
+  caught = false;
+  try {
+    hpx::kokkos::get_chunk_bounds(n, 0, 0);
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+  inst.fence();
+}
+
+template <typename ExecutionSpace>
+void test_deep_copy_batch(ExecutionSpace &&inst) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+  using view_type = Kokkos::View<int *, execution_space>;
+  using host_view_type = Kokkos::View<int *, Kokkos::HostSpace>;
+
+  int const num_views = 100;
+
+  std::vector<std::pair<view_type, host_view_type>> uploads;
+  std::vector<std::pair<host_view_type, view_type>> downloads;
+  for (int v = 0; v < num_views; ++v) {
+    host_view_type src("src", v + 1);
+    for (int i = 0; i <= v; ++i) {
+      src(i) = v * 1000 + i;
+    }
+    view_type dst("dst", v + 1);
+    uploads.emplace_back(dst, src);
+    downloads.emplace_back(host_view_type("result", v + 1), dst);
+  }
+
+  // Only one future is returned for the whole batch.
+  hpx::kokkos::deep_copy_async(inst, uploads).get();
+  hpx::kokkos::deep_copy_async(inst, downloads).get();
+  for (int v = 0; v < num_views; ++v) {
+    for (int i = 0; i <= v; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(downloads[v].first(i) == v * 1000 + i);
+    }
+  }
+
+  // Pairs can also be given directly, with different types.
+  Kokkos::View<double *, Kokkos::HostSpace> a("a", 3);
+  Kokkos::View<double *, Kokkos::HostSpace> b("b", 3);
+  host_view_type c("c", 5);
+  Kokkos::deep_copy(a, 1.5);
+  hpx::kokkos::deep_copy_async(inst, std::make_pair(b, a),
+                               std::make_pair(c, downloads[4].first))
+      .get();
+  HPX_KOKKOS_DETAIL_TEST(b(2) == 1.5);
+  HPX_KOKKOS_DETAIL_TEST(c(4) == 4004);
+
+  // Large copies are done with separate deep copies.
+  int const n = 1 << 20;
+  view_type large("large", n);
+  host_view_type large_host("large_host", n);
+  Kokkos::deep_copy(large_host, 7);
+  hpx::kokkos::deep_copy_async(
+      inst, std::vector<std::pair<view_type, host_view_type>>{
+                {large, large_host}})
+      .get();
+  Kokkos::deep_copy(large_host, 0);
+  Kokkos::deep_copy(large_host, large);
+  HPX_KOKKOS_DETAIL_TEST(large_host(n - 1) == 7);
+
+  HPX_KOKKOS_DETAIL_TEST(
+      hpx::kokkos::deep_copy_async(
+          inst, std::vector<std::pair<view_type, host_view_type>>{})
+          .is_ready());
+
+  // Contiguous views with the same span but transposed strides are copied
+  // element by element.
+  using stride_view_type =
+      Kokkos::View<int **, Kokkos::LayoutStride, Kokkos::HostSpace>;
+  stride_view_type row_major("row_major", Kokkos::LayoutStride(3, 4, 4, 1));
+  stride_view_type col_major("col_major", Kokkos::LayoutStride(3, 1, 4, 3));
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      row_major(i, j) = i * 4 + j;
+    }
+  }
+  hpx::kokkos::deep_copy_async(
+      inst, std::vector<std::pair<stride_view_type, stride_view_type>>{
+                {col_major, row_major}})
+      .get();
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      HPX_KOKKOS_DETAIL_TEST(col_major(i, j) == i * 4 + j);
+    }
+  }
+
+  // Views with the same span but different extents are rejected.
+  using host_matrix_type = Kokkos::View<int **, Kokkos::HostSpace>;
+  bool caught = false;
+  try {
+    hpx::kokkos::deep_copy_async(
+        inst, std::vector<std::pair<host_matrix_type, host_matrix_type>>{
+                  {host_matrix_type("wide", 2, 6),
+                   host_matrix_type("tall", 3, 4)}});
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+}
+
+template <typename ExecutionSpace>
+void test_deep_copy_strided(ExecutionSpace &&inst) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+  using block_type = Kokkos::View<int ***, execution_space>;
+  using host_face_type = Kokkos::View<int **, Kokkos::HostSpace>;
+
+  int const n = 17;
+  block_type block("block", n, n, n);
+  auto block_host = Kokkos::create_mirror_view(block);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      for (int k = 0; k < n; ++k) {
+        block_host(i, j, k) = (i * n + j) * n + k;
+      }
+    }
+  }
+  Kokkos::deep_copy(block, block_host);
+
+  // Faces of the block other than the first are strided.
+  auto const face_j = Kokkos::subview(block, Kokkos::ALL, 3, Kokkos::ALL);
+  auto const face_k = Kokkos::subview(block, Kokkos::ALL, Kokkos::ALL, n - 1);
+  host_face_type halo_j("halo_j", n, n);
+  host_face_type halo_k("halo_k", n, n);
+  hpx::kokkos::deep_copy_async(inst, halo_j, face_j).get();
+  hpx::kokkos::deep_copy_async(inst, halo_k, face_k).get();
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      HPX_KOKKOS_DETAIL_TEST(halo_j(i, j) == (i * n + 3) * n + j);
+      HPX_KOKKOS_DETAIL_TEST(halo_k(i, j) == (i * n + j) * n + n - 1);
+    }
+  }
+
+  // Copy one face onto another and back to a strided host view.
+  hpx::kokkos::deep_copy_async(
+      inst, Kokkos::subview(block, Kokkos::ALL, Kokkos::ALL, 0), halo_j)
+      .get();
+  auto const host_face =
+      Kokkos::subview(block_host, Kokkos::ALL, Kokkos::ALL, 0);
+  hpx::kokkos::deep_copy_async(
+      inst, host_face, Kokkos::subview(block, Kokkos::ALL, Kokkos::ALL, 0))
+      .get();
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      HPX_KOKKOS_DETAIL_TEST(block_host(i, j, 0) == halo_j(i, j));
+      HPX_KOKKOS_DETAIL_TEST(block_host(i, j, 1) == (i * n + j) * n + 1);
+    }
+  }
+}
+
+// Uses the packed copy directly, since deep_copy_async only chooses it when
+// the instance can not access both views, e.g. never in host-only builds.
+template <typename ExecutionSpace>
+void test_packed_deep_copy(ExecutionSpace &&inst) {
+  using execution_space = typename std::decay<ExecutionSpace>::type;
+  using host_face_type = Kokkos::View<int **, Kokkos::HostSpace>;
+
+  int const n = 13;
+  Kokkos::View<int ***, execution_space> block("block", n, n, n);
+  auto block_host = Kokkos::create_mirror_view(block);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      for (int k = 0; k < n; ++k) {
+        block_host(i, j, k) = (i * n + j) * n + k;
+      }
+    }
+  }
+  Kokkos::deep_copy(block, block_host);
+
+  // A strided face of a view in the memory space of the instance is packed
+  // on the instance and copied in bulk to a contiguous host view.
+  auto const face = Kokkos::subview(block, Kokkos::ALL, 5, Kokkos::ALL);
+  host_face_type halo("halo", n, n);
+  HPX_KOKKOS_DETAIL_TEST(
+      hpx::kokkos::detail::use_packed_deep_copy<execution_space>(halo, face));
+  hpx::kokkos::detail::packed_deep_copy(inst, halo, face).get();
+  for (int i = 0; i < n; ++i) {
+    for (int k = 0; k < n; ++k) {
+      HPX_KOKKOS_DETAIL_TEST(halo(i, k) == (i * n + 5) * n + k);
+    }
+  }
+
+  // A view whose layout differs from the packed order is unpacked on the
+  // instance.
+  Kokkos::View<int **, Kokkos::LayoutLeft, execution_space> left("left", n, n);
+  HPX_KOKKOS_DETAIL_TEST(
+      hpx::kokkos::detail::use_packed_deep_copy<execution_space>(left, halo));
+  hpx::kokkos::detail::packed_deep_copy(inst, left, halo).get();
+  auto const left_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), left);
+  for (int i = 0; i < n; ++i) {
+    for (int k = 0; k < n; ++k) {
+      HPX_KOKKOS_DETAIL_TEST(left_host(i, k) == (i * n + 5) * n + k);
+    }
+  }
+}
+
+template <typename ExecutionSpace>
+void test_deep_copy_host(ExecutionSpace &&inst) {
+  using host_view_type = Kokkos::View<double *, Kokkos::HostSpace>;
+
+  // Sizes below and above the thresholds for parallel copies and
+  // non-temporal stores, not divisible by the number of threads.
+  for (std::size_t n : {std::size_t(1000), std::size_t(300007),
+                        std::size_t(5000011)}) {
+    host_view_type src(Kokkos::view_alloc(Kokkos::WithoutInitializing, "src"),
+                       n);
+    host_view_type dst("dst", n + 1);
+    for (std::size_t i = 0; i < n; ++i) {
+      src(i) = 0.5 * i;
+    }
+
+    hpx::kokkos::deep_copy_async(
+        inst, Kokkos::subview(dst, std::make_pair(std::size_t(0), n)), src)
+        .get();
+    for (std::size_t i = 0; i < n; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(dst(i) == 0.5 * i);
+    }
+    HPX_KOKKOS_DETAIL_TEST(dst(n) == 0.0);
+
+    // Copying a view onto itself leaves it unchanged.
+    hpx::kokkos::deep_copy_async(inst, src, src).get();
+    for (std::size_t i = 0; i < n; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(src(i) == 0.5 * i);
+    }
+  }
+
+  // Large contiguous views with transposed strides are not copied
+  // byte by byte.
+  using stride_view_type =
+      Kokkos::View<double **, Kokkos::LayoutStride, Kokkos::HostSpace>;
+  int const m = 512;
+  stride_view_type row_major("row_major", Kokkos::LayoutStride(m, m, m, 1));
+  stride_view_type col_major("col_major", Kokkos::LayoutStride(m, 1, m, m));
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < m; ++j) {
+      row_major(i, j) = i * m + j;
+    }
+  }
+  hpx::kokkos::deep_copy_async(inst, col_major, row_major).get();
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < m; ++j) {
+      HPX_KOKKOS_DETAIL_TEST(col_major(i, j) == i * m + j);
+    }
+  }
+}
+
+template <typename ExecutionSpace> void test(ExecutionSpace &&inst) {
+  test_deep_copy_chunked(inst);
+  test_deep_copy_batch(inst);
+  test_deep_copy_strided(inst);
+  test_packed_deep_copy(inst);
+  test_deep_copy_host(inst);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test(Kokkos::DefaultExecutionSpace{});
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test(Kokkos::DefaultHostExecutionSpace{});
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,108 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests the histogram algorithm with all bin accumulation strategies.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <vector>
+
+template <typename Executor>
+void test_histogram(Executor &&exec, int const num_bins,
+                    hpx::kokkos::histogram_strategy const strategy) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+
+  int const n = 10007;
+
+  Kokkos::View<int *, execution_space> histogram_data("histogram_data", n);
+  Kokkos::View<int *, execution_space> bins("bins", num_bins);
+  auto histogram_data_host = Kokkos::create_mirror_view(histogram_data);
+  auto bins_host = Kokkos::create_mirror_view(bins);
+  for (std::size_t i = 0; i < n; ++i) {
+    histogram_data_host(i) = i;
+  }
+  Kokkos::deep_copy(histogram_data, histogram_data_host);
+  Kokkos::deep_copy(bins, 1);
+
+  // Every third element is mapped outside the bins and ignored.
+  hpx::kokkos::histogram_async(
+      hpx::kokkos::kok.on(exec).label("histogram view"), histogram_data, bins,
+      KOKKOS_LAMBDA(int x) { return x % 3 == 0 ? -1 : x % num_bins; },
+      strategy)
+      .get();
+
+  Kokkos::deep_copy(bins_host, bins);
+  std::vector<int> expected(num_bins, 1);
+  for (int i = 0; i < n; ++i) {
+    if (i % 3 != 0) {
+      ++expected[i % num_bins];
+    }
+  }
+  for (int b = 0; b < num_bins; ++b) {
+    HPX_KOKKOS_DETAIL_TEST(bins_host(b) == expected[b]);
+  }
+
+  // Indices from a range policy
+  Kokkos::deep_copy(bins, 0);
+  hpx::kokkos::histogram_async(
+      hpx::kokkos::kok.on(exec).label("histogram range policy"),
+      Kokkos::RangePolicy<execution_space>(0, n), bins,
+      KOKKOS_LAMBDA(int i) { return i % num_bins; }, strategy)
+      .get();
+
+  Kokkos::deep_copy(bins_host, bins);
+  for (int b = 0; b < num_bins; ++b) {
+    HPX_KOKKOS_DETAIL_TEST(bins_host(b) ==
+                           n / num_bins + (b < n % num_bins ? 1 : 0));
+  }
+}
+
+template <typename Executor> void test(Executor &&exec) {
+  using hpx::kokkos::histogram_strategy;
+
+  for (auto strategy :
+       {histogram_strategy::privatized, histogram_strategy::scatter_view,
+        histogram_strategy::atomic}) {
+    test_histogram(exec, 1, strategy);
+    test_histogram(exec, 17, strategy);
+  }
+
+  // More bins than fit into team scratch memory on device execution spaces,
+  // where the privatized strategy falls back to the scatter_view strategy.
+  test_histogram(exec, 20000, histogram_strategy::privatized);
+
+  test_histogram(exec, 7, histogram_strategy::automatic);
+  test_histogram(exec, 1000, histogram_strategy::automatic);
+  test_histogram(exec, 20000, histogram_strategy::automatic);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test(hpx::kokkos::default_executor{});
+    if (!std::is_same<hpx::kokkos::default_executor,
+                      hpx::kokkos::default_host_executor>::value) {
+      test(hpx::kokkos::default_host_executor{});
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -9,9 +9,11 @@
 #include "test.hpp"
 
 #include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/kokkos.hpp>
 #include <hpx/kokkos/detail/polling_helper.hpp>
+#include <hpx/thread.hpp>
 
 #include <string>
 
@@ -97,12 +99,52 @@ void test_parallel_scan(ExecutionSpace &&inst) {
   HPX_KOKKOS_DETAIL_TEST(sum == (n - 1) * n / 2);
 }
 
+template <typename ExecutionSpace>
+void test_keep_alive(ExecutionSpace &&inst) {
+  int const n = 43;
+
+  Kokkos::View<int *, typename std::decay<ExecutionSpace>::type>
+      keep_alive_data("keep_alive_data", n);
+  auto f = hpx::kokkos::keep_alive(
+      hpx::kokkos::parallel_for_async(
+          Kokkos::RangePolicy<typename std::decay<ExecutionSpace>::type>(inst,
+                                                                         0, n),
+          KOKKOS_LAMBDA(int i) { keep_alive_data(i) = i; }),
+      keep_alive_data);
+  HPX_KOKKOS_DETAIL_TEST(keep_alive_data.use_count() >= 1);
+  f.get();
+
+  // The reference held by keep_alive is released in a continuation after the
+  // kernel has completed.
+  hpx::chrono::high_resolution_timer timer;
+  while (keep_alive_data.use_count() > 1 && timer.elapsed() < 10.0) {
+    hpx::this_thread::yield();
+  }
+  HPX_KOKKOS_DETAIL_TEST(keep_alive_data.use_count() == 1);
+
+  // With a future that is only made ready by the test, the reference held by
+  // keep_alive is deterministically alive until then.
+  hpx::promise<void> p;
+  auto f_promise = hpx::kokkos::keep_alive(p.get_shared_future(),
+                                           keep_alive_data);
+  HPX_KOKKOS_DETAIL_TEST(keep_alive_data.use_count() >= 2);
+  p.set_value();
+  f_promise.get();
+
+  timer.restart();
+  while (keep_alive_data.use_count() > 1 && timer.elapsed() < 10.0) {
+    hpx::this_thread::yield();
+  }
+  HPX_KOKKOS_DETAIL_TEST(keep_alive_data.use_count() == 1);
+}
+
 template <typename ExecutionSpace> void test(ExecutionSpace &&inst) {
   static_assert(Kokkos::is_execution_space<ExecutionSpace>::value,
                 "ExecutionSpace is not a Kokkos execution space");
   test_parallel_for(inst);
   test_parallel_reduce(inst);
   test_parallel_scan(inst);
+  test_keep_alive(inst);
 }
 
 int test_main(int argc, char *argv[]) {
@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests asynchronous creation of mirror views with caching.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <type_traits>
+
+template <typename ExecutionSpace> void test_mirror_view() {
+  using view_type = Kokkos::View<int *, ExecutionSpace>;
+
+  int const n = 1000;
+  ExecutionSpace inst;
+  view_type v("v", n);
+
+  bool const accessible =
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 typename view_type::memory_space>::accessible;
+
+  for (int snapshot = 0; snapshot < 3; ++snapshot) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace>(inst, 0, n),
+        KOKKOS_LAMBDA(int i) { v(i) = snapshot * n + i; });
+
+    auto f = hpx::kokkos::create_mirror_view_and_copy_async(
+        inst, Kokkos::HostSpace(), v);
+    if (accessible) {
+      // The returned future does not wait for work on the view.
+      HPX_KOKKOS_DETAIL_TEST(f.is_ready());
+      inst.fence();
+    }
+    auto mirror = f.get();
+    static_assert(
+        Kokkos::SpaceAccessibility<
+            Kokkos::HostSpace,
+            typename decltype(mirror)::memory_space>::accessible,
+        "mirror must be accessible from the host");
+
+    for (int i = 0; i < n; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(mirror(i) == snapshot * n + i);
+    }
+
+    // Repeated snapshots reuse the same mirror. Accessible views are
+    // returned as is.
+    auto const again =
+        hpx::kokkos::create_mirror_view_and_copy_async(Kokkos::HostSpace(), v)
+            .get();
+    HPX_KOKKOS_DETAIL_TEST(again.data() == mirror.data());
+    HPX_KOKKOS_DETAIL_TEST(accessible == (mirror.data() == v.data()));
+  }
+
+  // Subviews get their own mirror.
+  auto const sub = Kokkos::subview(v, std::make_pair(10, 20));
+  auto const sub_mirror =
+      hpx::kokkos::create_mirror_view_and_copy_async(inst, Kokkos::HostSpace(),
+                                                     sub)
+          .get();
+  HPX_KOKKOS_DETAIL_TEST(sub_mirror.extent(0) == 10);
+  HPX_KOKKOS_DETAIL_TEST(sub_mirror(0) == 2 * n + 10);
+
+  // Mirrors of views that are only referenced by the cache are evicted on
+  // the next call.
+  auto &cache = hpx::kokkos::detail::mirror_cache::get();
+  hpx::kokkos::release_mirror_cache();
+  {
+    view_type temporary("temporary", n);
+    hpx::kokkos::create_mirror_view_and_copy_async(inst, Kokkos::HostSpace(),
+                                                   temporary)
+        .get();
+    HPX_KOKKOS_DETAIL_TEST(cache.size() == (accessible ? 0 : 1));
+  }
+  hpx::kokkos::create_mirror_view_and_copy_async(inst, Kokkos::HostSpace(), v)
+      .get();
+  HPX_KOKKOS_DETAIL_TEST(cache.size() == (accessible ? 0 : 1));
+
+  hpx::kokkos::release_mirror_cache();
+  HPX_KOKKOS_DETAIL_TEST(cache.size() == 0);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_mirror_view<Kokkos::DefaultHostExecutionSpace>();
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test_mirror_view<Kokkos::DefaultExecutionSpace>();
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -14,6 +14,9 @@
 #include <hpx/kokkos/detail/polling_helper.hpp>
 #include <hpx/numeric.hpp>
 
+#include <type_traits>
+#include <utility>
+
 template <typename Executor> void test_for_each(Executor &&exec) {
   int const n = 43;
 
@@ -115,6 +118,93 @@ template <typename Executor> void test_for_each_mdrange(Executor &&exec) {
   }
 }
 
+template <typename Executor> void test_for_each_team(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+  using policy_type = Kokkos::TeamPolicy<execution_space>;
+  using member_type = typename policy_type::member_type;
+  using scratch_view_type =
+      Kokkos::View<int *, typename execution_space::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  int const n = 43;
+  int const m = 17;
+  policy_type p(n, Kokkos::AUTO);
+  p.set_scratch_size(0, Kokkos::PerTeam(scratch_view_type::shmem_size(m)));
+
+  Kokkos::View<int **, execution_space> for_each_data("for_each_data", n, m);
+  auto for_each_data_host = Kokkos::create_mirror_view(for_each_data);
+
+  auto f = hpx::ranges::for_each(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("for_each task team"),
+      p, KOKKOS_LAMBDA(member_type const &team) {
+        int const i = team.league_rank();
+        scratch_view_type scratch(team.team_scratch(0), m);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m),
+                             [&](int j) { scratch(j) = i + j; });
+        team.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m),
+                             [&](int j) { for_each_data(i, j) = scratch(j); });
+      });
+
+  f.get();
+
+  Kokkos::deep_copy(for_each_data_host, for_each_data);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      HPX_KOKKOS_DETAIL_TEST(for_each_data_host(i, j) == i + j);
+    }
+  }
+}
+
+struct team_tag {};
+
+template <typename ExecutionSpace> struct tagged_team_functor {
+  Kokkos::View<int *, ExecutionSpace> data;
+
+  template <typename Member>
+  KOKKOS_INLINE_FUNCTION void operator()(team_tag, Member const &team) const {
+    int const i = team.league_rank();
+    Kokkos::single(Kokkos::PerTeam(team), [&]() { data(i) = 2 * i; });
+  }
+};
+
+// The work tag and schedule of a team policy are kept when it is moved to the
+// instance of the executor.
+template <typename Executor> void test_for_each_team_tagged(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+  using policy_type =
+      Kokkos::TeamPolicy<Kokkos::Schedule<Kokkos::Dynamic>, team_tag,
+                         execution_space>;
+  using instance_policy_type =
+      decltype(hpx::kokkos::detail::make_team_policy_on_instance(
+          exec.instance(), std::declval<policy_type const &>()));
+  static_assert(std::is_same<typename instance_policy_type::work_tag,
+                             team_tag>::value,
+                "the work tag of a team policy must be preserved");
+  static_assert(
+      std::is_same<typename instance_policy_type::schedule_type::type,
+                   Kokkos::Dynamic>::value,
+      "the schedule of a team policy must be preserved");
+
+  int const n = 43;
+  Kokkos::View<int *, execution_space> data("data", n);
+  hpx::ranges::for_each(hpx::kokkos::kok(hpx::execution::task)
+                            .on(exec)
+                            .label("for_each task tagged team"),
+                        policy_type(n, Kokkos::AUTO),
+                        tagged_team_functor<execution_space>{data})
+      .get();
+
+  auto const data_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (int i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(data_host(i) == 2 * i);
+  }
+}
+
 void test_for_each_default() {
   int const n = 43;
 
@@ -395,6 +485,153 @@ template <typename Executor> void test_reduce(Executor &&exec) {
       KOKKOS_LAMBDA(int x, int y) { return x + y; });
 
   HPX_KOKKOS_DETAIL_TEST(f_result.get() == (offset + (n * (n - 1)) / 2));
+
+  // The result type may differ from the element type.
+  double const offset_double = 0.5;
+  double result_double = hpx::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce sync mixed"), reduce_data.data(),
+      reduce_data.data() + reduce_data.size(), offset_double,
+      KOKKOS_LAMBDA(double x, double y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(result_double ==
+                         (offset_double + (n * (n - 1)) / 2));
+}
+
+template <typename Executor> void test_reduce_range(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+
+  int const n = 43;
+  int const m = 17;
+  int const k = 5;
+  int const offset = -3;
+
+  Kokkos::RangePolicy<> const p(0, n);
+  auto f_range = hpx::ranges::reduce(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("reduce task range"),
+      p, offset, KOKKOS_LAMBDA(int i, int &update) { update += i; });
+  HPX_KOKKOS_DETAIL_TEST(f_range.get() == (offset + (n * (n - 1)) / 2));
+
+  Kokkos::MDRangePolicy<Kokkos::Rank<2>> const p2({0, 0}, {n, m});
+  int result_mdrange = hpx::ranges::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce sync mdrange"), p2, offset,
+      KOKKOS_LAMBDA(int i, int j, int &update) { update += i * j; });
+  HPX_KOKKOS_DETAIL_TEST(result_mdrange ==
+                         (offset + ((n * (n - 1)) / 2) * ((m * (m - 1)) / 2)));
+
+  Kokkos::View<int ***, execution_space> reduce_data("reduce_data", n, m, k);
+  auto reduce_data_host = Kokkos::create_mirror_view(reduce_data);
+  int expected = offset;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      for (std::size_t l = 0; l < k; ++l) {
+        reduce_data_host(i, j, l) = i + j * l;
+        expected += i + j * l;
+      }
+    }
+  }
+  Kokkos::deep_copy(reduce_data, reduce_data_host);
+
+  auto f_view = hpx::ranges::reduce(
+      hpx::kokkos::kok(hpx::execution::task).on(exec).label("reduce task view"),
+      reduce_data, offset, KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(f_view.get() == expected);
+
+  // Tiles follow the dimension with the smallest stride, which is the first
+  // dimension for LayoutLeft.
+  Kokkos::View<int ***, Kokkos::LayoutLeft, execution_space> reduce_data_left(
+      "reduce_data_left", n, m, k);
+  Kokkos::deep_copy(reduce_data_left, reduce_data);
+  int result_left = hpx::ranges::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce sync view left"),
+      reduce_data_left, offset, KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(result_left == expected);
+
+  auto reduce_data_1d = Kokkos::subview(reduce_data, Kokkos::ALL, 1, 2);
+  int expected_1d = offset;
+  for (std::size_t i = 0; i < n; ++i) {
+    expected_1d += reduce_data_host(i, 1, 2);
+  }
+  int result_1d = hpx::ranges::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce sync subview"), reduce_data_1d,
+      offset, KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(result_1d == expected_1d);
+}
+
+template <typename Executor> void test_reduce_reducers(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+
+  int const n = 43;
+
+  Kokkos::View<int *, execution_space> reduce_data("reduce_data", n);
+  auto reduce_data_host = Kokkos::create_mirror_view(reduce_data);
+  for (std::size_t i = 0; i < n; ++i) {
+    reduce_data_host(i) = (i * 7) % n - 5;
+  }
+  Kokkos::deep_copy(reduce_data, reduce_data_host);
+
+  // A binary operation that is not a sum must also be used for joining
+  // partial results.
+  int result_max = hpx::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce sync max op"),
+      reduce_data.data(), reduce_data.data() + reduce_data.size(), -100,
+      KOKKOS_LAMBDA(int x, int y) { return x > y ? x : y; });
+  HPX_KOKKOS_DETAIL_TEST(result_max == n - 6);
+
+  Kokkos::View<int, Kokkos::HostSpace> max_result("max_result");
+  auto f_max = hpx::reduce(
+      hpx::kokkos::kok(hpx::execution::task).on(exec).label("reduce task Max"),
+      reduce_data.data(), reduce_data.data() + reduce_data.size(),
+      Kokkos::Max<int>(max_result));
+  HPX_KOKKOS_DETAIL_TEST(f_max.get() == n - 6);
+  HPX_KOKKOS_DETAIL_TEST(max_result() == n - 6);
+
+  Kokkos::View<int, Kokkos::HostSpace> sum_result("sum_result");
+  Kokkos::View<int, Kokkos::HostSpace> min_result("min_result");
+  auto f_multi = hpx::ranges::reduce(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("reduce task multiple view"),
+      reduce_data,
+      hpx::make_tuple(Kokkos::Sum<int>(sum_result),
+                      Kokkos::Max<int>(max_result),
+                      Kokkos::Min<int>(min_result)),
+      KOKKOS_LAMBDA(int x, int &sum, int &max, int &min) {
+        sum += x;
+        max = x > max ? x : max;
+        min = x < min ? x : min;
+      });
+  auto result_multi = f_multi.get();
+  HPX_KOKKOS_DETAIL_TEST(hpx::get<0>(result_multi) ==
+                         (n * (n - 1)) / 2 - 5 * n);
+  HPX_KOKKOS_DETAIL_TEST(hpx::get<1>(result_multi) == n - 6);
+  HPX_KOKKOS_DETAIL_TEST(hpx::get<2>(result_multi) == -5);
+
+  Kokkos::RangePolicy<> const p(0, n);
+  int result_prod = hpx::ranges::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce sync Prod range"), p,
+      Kokkos::Prod<int>(max_result),
+      KOKKOS_LAMBDA(int i, int &update) { update *= (i % 3 == 0 ? 2 : 1); });
+  HPX_KOKKOS_DETAIL_TEST(result_prod == (1 << ((n + 2) / 3)));
+
+  // A binary operation on a policy reduces the indices with the operation
+  // instead of summing partial results.
+  int result_range_max = hpx::ranges::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce sync max op range"), p, -100,
+      KOKKOS_LAMBDA(int x, int y) { return x > y ? x : y; });
+  HPX_KOKKOS_DETAIL_TEST(result_range_max == n - 1);
+
+  // The result of a reducer with a result view in the memory space of the
+  // execution space is copied to the host.
+  using memory_space = typename execution_space::memory_space;
+  Kokkos::View<int, memory_space> max_result_device("max_result_device");
+  auto f_max_device = hpx::reduce(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("reduce task Max device"),
+      reduce_data.data(), reduce_data.data() + reduce_data.size(),
+      Kokkos::Max<int, memory_space>(max_result_device));
+  HPX_KOKKOS_DETAIL_TEST(f_max_device.get() == n - 6);
 }
 
 void test_reduce_default() {
@@ -425,6 +662,188 @@ void test_reduce_default() {
   HPX_KOKKOS_DETAIL_TEST(f_result.get() == (offset + (n * (n - 1)) / 2));
 }
 
+template <typename Executor> void test_compaction(Executor &&exec) {
+  int const n = 43;
+
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> in_host("in_host", n);
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> out_host("out_host",
+                                                                  n);
+  Kokkos::View<int *, typename std::decay<Executor>::type::execution_space> in(
+      "in", n);
+  Kokkos::View<int *, typename std::decay<Executor>::type::execution_space>
+      out_true("out_true", n);
+  Kokkos::View<int *, typename std::decay<Executor>::type::execution_space>
+      out_false("out_false", n);
+  for (std::size_t i = 0; i < n; ++i) {
+    in_host(i) = i / 2;
+  }
+  Kokkos::deep_copy(in, in_host);
+
+  int *copy_end = hpx::copy_if(
+      hpx::kokkos::kok.on(exec).label("copy_if sync"), in.data(),
+      in.data() + n, out_true.data(),
+      KOKKOS_LAMBDA(int x) { return x % 3 == 0; });
+  int const num_copied = copy_end - out_true.data();
+  int expected_num_copied = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    expected_num_copied += in_host(i) % 3 == 0;
+  }
+  HPX_KOKKOS_DETAIL_TEST(num_copied == expected_num_copied);
+  Kokkos::deep_copy(out_host, out_true);
+  for (int i = 0; i < num_copied; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) == 3 * (i / 2));
+  }
+
+  auto f_remove = hpx::remove_copy_if(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("remove_copy_if task"),
+      in.data(), in.data() + n, out_false.data(),
+      KOKKOS_LAMBDA(int x) { return x % 3 == 0; });
+  HPX_KOKKOS_DETAIL_TEST(f_remove.get() - out_false.data() == n - num_copied);
+
+  auto ends = hpx::partition_copy(
+      hpx::kokkos::kok.on(exec).label("partition_copy sync"), in.data(),
+      in.data() + n, out_true.data(), out_false.data(),
+      KOKKOS_LAMBDA(int x) { return x % 3 == 0; });
+  HPX_KOKKOS_DETAIL_TEST(ends.first - out_true.data() == num_copied);
+  HPX_KOKKOS_DETAIL_TEST(ends.second - out_false.data() == n - num_copied);
+  Kokkos::deep_copy(out_host, out_false);
+  for (int i = 0; i < n - num_copied; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) % 3 != 0);
+    HPX_KOKKOS_DETAIL_TEST(i == 0 || out_host(i - 1) <= out_host(i));
+  }
+
+  auto f_unique = hpx::unique_copy(
+      hpx::kokkos::kok(hpx::execution::task).on(exec).label("unique_copy task"),
+      in.data(), in.data() + n, out_true.data());
+  int const num_unique = f_unique.get() - out_true.data();
+  HPX_KOKKOS_DETAIL_TEST(num_unique == (n + 1) / 2);
+  Kokkos::deep_copy(out_host, out_true);
+  for (int i = 0; i < num_unique; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) == i);
+  }
+}
+
+template <typename Executor> void test_by_key(Executor &&exec) {
+  int const n = 43;
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> keys_host("keys_host",
+                                                                   n);
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> out_host("out_host",
+                                                                  n);
+  Kokkos::View<int *, execution_space> keys("keys", n);
+  Kokkos::View<int *, execution_space> values("values", n);
+  Kokkos::View<int *, execution_space> keys_out("keys_out", n);
+  Kokkos::View<int *, execution_space> values_out("values_out", n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys_host(i) = i / 5;
+  }
+  Kokkos::deep_copy(keys, keys_host);
+  Kokkos::deep_copy(values, 1);
+
+  auto ends = hpx::kokkos::reduce_by_key(
+      hpx::kokkos::kok.on(exec).label("reduce_by_key sync"), keys.data(),
+      keys.data() + n, values.data(), keys_out.data(), values_out.data());
+  int const num_keys = (n + 4) / 5;
+  HPX_KOKKOS_DETAIL_TEST(ends.first - keys_out.data() == num_keys);
+  HPX_KOKKOS_DETAIL_TEST(ends.second - values_out.data() == num_keys);
+  Kokkos::deep_copy(out_host, keys_out);
+  for (int i = 0; i < num_keys; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) == i);
+  }
+  Kokkos::deep_copy(out_host, values_out);
+  for (int i = 0; i < num_keys; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) == (i == num_keys - 1 ? n % 5 : 5));
+  }
+
+  auto f_scan = hpx::kokkos::inclusive_scan_by_key(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("inclusive_scan_by_key task"),
+      keys.data(), keys.data() + n, values.data(), values_out.data());
+  HPX_KOKKOS_DETAIL_TEST(f_scan.get() == values_out.data() + n);
+  Kokkos::deep_copy(out_host, values_out);
+  for (std::size_t i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) == int(i % 5 + 1));
+  }
+
+  auto f_max = hpx::kokkos::reduce_by_key(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("reduce_by_key task max"),
+      keys.data(), keys.data() + n, keys.data(), keys_out.data(),
+      values_out.data(), KOKKOS_LAMBDA(int x, int y) { return x == y; },
+      KOKKOS_LAMBDA(int x, int y) { return x > y ? x : y; });
+  HPX_KOKKOS_DETAIL_TEST(f_max.get().second - values_out.data() == num_keys);
+  Kokkos::deep_copy(out_host, values_out);
+  for (int i = 0; i < num_keys; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) == i);
+  }
+}
+
+// Uses enough elements and segments of varying length that partial results
+// are joined across threads and teams. The operation in reduce_by_key (keep
+// the later value) is associative but not commutative, so joining partial
+// results in the wrong order gives wrong results.
+template <typename Executor> void test_by_key_many_segments(Executor &&exec) {
+  int const n = 1 << 20;
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+
+  Kokkos::View<int *, execution_space> keys("keys", n);
+  Kokkos::View<int *, execution_space> values("values", n);
+  Kokkos::View<int *, execution_space> keys_out("keys_out", n);
+  Kokkos::View<int *, execution_space> values_out("values_out", n);
+  auto keys_host = Kokkos::create_mirror_view(keys);
+  auto values_host = Kokkos::create_mirror_view(values);
+  auto out_host = Kokkos::create_mirror_view(values_out);
+
+  int num_keys = 0;
+  for (int i = 0, length = 0; i < n; ++i, --length) {
+    if (length == 0) {
+      length = 1 + num_keys % 97;
+      ++num_keys;
+    }
+    keys_host(i) = num_keys - 1;
+    values_host(i) = i % 13;
+  }
+  Kokkos::deep_copy(keys, keys_host);
+  Kokkos::deep_copy(values, values_host);
+
+  auto f_scan = hpx::kokkos::inclusive_scan_by_key(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("inclusive_scan_by_key task many segments"),
+      keys.data(), keys.data() + n, values.data(), values_out.data());
+  HPX_KOKKOS_DETAIL_TEST(f_scan.get() == values_out.data() + n);
+  Kokkos::deep_copy(out_host, values_out);
+  int expected_scan = 0;
+  for (int i = 0; i < n; ++i) {
+    expected_scan = (i == 0 || keys_host(i - 1) != keys_host(i))
+                        ? values_host(i)
+                        : expected_scan + values_host(i);
+    HPX_KOKKOS_DETAIL_TEST(out_host(i) == expected_scan);
+  }
+
+  auto ends = hpx::kokkos::reduce_by_key(
+      hpx::kokkos::kok.on(exec).label("reduce_by_key sync many segments"),
+      keys.data(), keys.data() + n, values.data(), keys_out.data(),
+      values_out.data(), KOKKOS_LAMBDA(int x, int y) { return x == y; },
+      KOKKOS_LAMBDA(int, int y) { return y; });
+  HPX_KOKKOS_DETAIL_TEST(ends.first - keys_out.data() == num_keys);
+  auto keys_out_host = Kokkos::create_mirror_view(keys_out);
+  Kokkos::deep_copy(keys_out_host, keys_out);
+  Kokkos::deep_copy(out_host, values_out);
+  for (int i = 0, k = 0; i < n; ++i) {
+    if (i == n - 1 || keys_host(i) != keys_host(i + 1)) {
+      HPX_KOKKOS_DETAIL_TEST(keys_out_host(k) == keys_host(i));
+      HPX_KOKKOS_DETAIL_TEST(out_host(k) == values_host(i));
+      ++k;
+    }
+  }
+}
+
 template <typename Executor> void test(Executor &&exec) {
   static_assert(hpx::kokkos::is_kokkos_executor<Executor>::value,
                 "Executor is not a Kokkos executor");
@@ -438,8 +857,15 @@ template <typename Executor> void test(Executor &&exec) {
   test_for_each(exec);
   test_for_each_range(exec);
   test_for_each_mdrange(exec);
+  test_for_each_team(exec);
+  test_for_each_team_tagged(exec);
   test_for_loop(exec);
   test_reduce(exec);
+  test_reduce_range(exec);
+  test_reduce_reducers(exec);
+  test_compaction(exec);
+  test_by_key(exec);
+  test_by_key_many_segments(exec);
 }
 
 void test_default() {
@@ -466,6 +892,15 @@ int test_main(int argc, char *argv[]) {
       test(hpx::kokkos::default_host_executor{});
     }
     test_default();
+
+    // The segmented scans of the by-key algorithms are also tested on host
+    // execution spaces with multiple threads, if the defaults are serial.
+#if defined(KOKKOS_ENABLE_HPX)
+    test_by_key_many_segments(hpx::kokkos::hpx_executor{});
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+    test_by_key_many_segments(hpx::kokkos::openmp_executor{});
+#endif
   }
 
   Kokkos::finalize();
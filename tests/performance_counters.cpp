@@ -0,0 +1,118 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests the performance counters of kernels, futures, and fences.
+
+#include <hpx/config.hpp>
+
+// The counters are enabled for this test even if they are not enabled for the
+// library target.
+#if defined(HPX_HAVE_DISTRIBUTED_RUNTIME) &&                                   \
+    !defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+#define HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS
+#endif
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+std::int64_t get_counter_value(std::string const &name) {
+  hpx::performance_counters::performance_counter counter(
+      "/kokkos{locality#0/total}/" + name);
+  return counter.get_value<std::int64_t>().get();
+}
+
+template <typename ExecutionSpace> std::string get_launches_counter_name() {
+  return std::string("count/launches/") +
+         hpx::kokkos::detail::counted_execution_space_name(
+             hpx::kokkos::detail::get_counted_execution_space<
+                 ExecutionSpace>());
+}
+
+template <typename ExecutionSpace> void test_launch_counters() {
+  std::string const launches = get_launches_counter_name<ExecutionSpace>();
+  std::int64_t const launches_before = get_counter_value(launches);
+  std::int64_t const futures_before = get_counter_value("count/futures");
+
+  Kokkos::View<int *, typename ExecutionSpace::memory_space> a("a", 100);
+  hpx::kokkos::parallel_for_async(
+      Kokkos::RangePolicy<ExecutionSpace>(ExecutionSpace(), 0, 100),
+      KOKKOS_LAMBDA(int i) { a(i) = i; })
+      .get();
+
+  HPX_KOKKOS_DETAIL_TEST(get_counter_value(launches) == launches_before + 1);
+  HPX_KOKKOS_DETAIL_TEST(get_counter_value("count/futures") ==
+                         futures_before + 1);
+  HPX_KOKKOS_DETAIL_TEST(get_counter_value("count/outstanding-futures") >= 0);
+}
+
+void test_fence_fallback_counters() {
+#if defined(KOKKOS_ENABLE_SERIAL)
+  std::int64_t const fallbacks_before =
+      get_counter_value("count/fence-fallbacks");
+  std::int64_t const fence_time_before = get_counter_value("time/fences");
+
+  hpx::kokkos::get_future<Kokkos::Serial>().get();
+
+  HPX_KOKKOS_DETAIL_TEST(get_counter_value("count/fence-fallbacks") ==
+                         fallbacks_before + 1);
+  HPX_KOKKOS_DETAIL_TEST(get_counter_value("time/fences") >=
+                         fence_time_before);
+#endif
+}
+
+void test_instance_helper_counters() {
+  std::int64_t const instances_before =
+      get_counter_value("count/instance-helper/instances");
+  std::int64_t const requests_before =
+      get_counter_value("count/instance-helper/requests");
+
+  hpx::kokkos::kokkos_instance_helper<Kokkos::DefaultHostExecutionSpace>
+      helper(3, 2);
+  helper.get_execution_space(0);
+  helper.get_execution_space(1);
+
+  HPX_KOKKOS_DETAIL_TEST(get_counter_value("count/instance-helper/instances") ==
+                         instances_before + 6);
+  HPX_KOKKOS_DETAIL_TEST(get_counter_value("count/instance-helper/requests") ==
+                         requests_before + 2);
+}
+#endif
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+#if defined(HPX_KOKKOS_ENABLE_PERFORMANCE_COUNTERS)
+    test_launch_counters<Kokkos::DefaultHostExecutionSpace>();
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test_launch_counters<Kokkos::DefaultExecutionSpace>();
+    }
+    test_fence_fallback_counters();
+    test_instance_helper_counters();
+#endif
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
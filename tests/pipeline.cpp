@@ -0,0 +1,108 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests fused algorithm pipelines.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+template <typename Executor> void test_pipeline(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+
+  int const n = 43;
+
+  Kokkos::View<int *, execution_space> pipeline_data("pipeline_data", n);
+  Kokkos::View<int *, execution_space> pipeline_out("pipeline_out", n);
+  auto pipeline_data_host = Kokkos::create_mirror_view(pipeline_data);
+  auto pipeline_out_host = Kokkos::create_mirror_view(pipeline_out);
+  for (std::size_t i = 0; i < n; ++i) {
+    pipeline_data_host(i) = i;
+  }
+  Kokkos::deep_copy(pipeline_data, pipeline_data_host);
+
+  // transform and filter followed by reduce over a view
+  int result = hpx::kokkos::pipeline(
+                   hpx::kokkos::kok.on(exec).label("pipeline sync reduce"),
+                   pipeline_data)
+                   .transform(KOKKOS_LAMBDA(int x) { return 2 * x; })
+                   .filter(KOKKOS_LAMBDA(int x) { return x % 3 == 0; })
+                   .reduce(1, KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  int expected = 1;
+  for (int i = 0; i < n; ++i) {
+    if ((2 * i) % 3 == 0) {
+      expected += 2 * i;
+    }
+  }
+  HPX_KOKKOS_DETAIL_TEST(result == expected);
+
+  // The result type may differ from the element type.
+  double result_double =
+      hpx::kokkos::pipeline(
+          hpx::kokkos::kok.on(exec).label("pipeline sync reduce mixed"),
+          pipeline_data)
+          .transform(KOKKOS_LAMBDA(int x) { return 2 * x; })
+          .reduce(0.5, KOKKOS_LAMBDA(double x, double y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(result_double == 0.5 + n * (n - 1));
+
+  // inspect writes intermediate values, reduce with a Kokkos reducer
+  Kokkos::View<int, Kokkos::HostSpace> max_result("max_result");
+  auto f = hpx::kokkos::pipeline(
+               hpx::kokkos::kok(hpx::execution::task)
+                   .on(exec)
+                   .label("pipeline task reduce"),
+               Kokkos::RangePolicy<>(0, n))
+               .transform(KOKKOS_LAMBDA(int i) { return n - 1 - i; })
+               .inspect(KOKKOS_LAMBDA(int x) { pipeline_out(x) = 3 * x; })
+               .reduce(Kokkos::Max<int>(max_result));
+  HPX_KOKKOS_DETAIL_TEST(f.get() == n - 1);
+  Kokkos::deep_copy(pipeline_out_host, pipeline_out);
+  for (std::size_t i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(pipeline_out_host(i) == 3 * i);
+  }
+
+  // for_each over an iterator range
+  hpx::kokkos::pipeline(
+      hpx::kokkos::kok.on(exec).label("pipeline sync for_each"),
+      pipeline_data.data(), pipeline_data.data() + pipeline_data.size())
+      .filter(KOKKOS_LAMBDA(int x) { return x % 2 == 0; })
+      .for_each(KOKKOS_LAMBDA(int x) { pipeline_out(x) = -x; });
+  Kokkos::deep_copy(pipeline_out_host, pipeline_out);
+  for (std::size_t i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(pipeline_out_host(i) ==
+                           (i % 2 == 0 ? -int(i) : 3 * int(i)));
+  }
+}
+
+template <typename Executor> void test(Executor &&exec) {
+  test_pipeline(exec);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test(hpx::kokkos::default_executor{});
+    if (!std::is_same<hpx::kokkos::default_executor,
+                      hpx::kokkos::default_host_executor>::value) {
+      test(hpx::kokkos::default_host_executor{});
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests per-instance scratch arenas.
+
+#include "test.hpp"
+
+#include <hpx/algorithm.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <cstdint>
+
+void test_lease() {
+  auto &arena = hpx::kokkos::get_scratch_arena<Kokkos::HostSpace>(
+      Kokkos::DefaultHostExecutionSpace());
+  auto const stats_before = arena.statistics();
+
+  {
+    auto lease = arena.acquire();
+    auto a = lease.allocate<double>(100);
+    auto b = lease.allocate<char>(3);
+    auto c = lease.allocate<std::int64_t>();
+    HPX_KOKKOS_DETAIL_TEST(a.extent(0) == 100);
+    HPX_KOKKOS_DETAIL_TEST(b.extent(0) == 3);
+    HPX_KOKKOS_DETAIL_TEST(reinterpret_cast<std::uintptr_t>(c.data()) %
+                               alignof(std::int64_t) ==
+                           0);
+    HPX_KOKKOS_DETAIL_TEST(a.data() != nullptr && c.data() != nullptr);
+
+    for (int i = 0; i < 100; ++i) {
+      a(i) = i;
+    }
+    c() = 42;
+    HPX_KOKKOS_DETAIL_TEST(a(99) == 99 && c() == 42);
+  }
+
+  // If the buffer was too small, overflow blocks were allocated. The buffer is
+  // grown on the next acquire, after which the same amount of memory fits.
+  auto const stats_grown = [&] {
+    auto lease = arena.acquire();
+    lease.allocate<double>(100);
+    lease.allocate<char>(3);
+    lease.allocate<std::int64_t>();
+    return arena.statistics();
+  }();
+  HPX_KOKKOS_DETAIL_TEST(stats_grown.capacity >= 100 * sizeof(double));
+
+  {
+    auto lease1 = arena.acquire();
+    auto a = lease1.allocate<double>(10);
+    auto lease2 = arena.acquire();
+    auto b = lease2.allocate<double>(10);
+    // Memory of concurrent leases must not overlap.
+    HPX_KOKKOS_DETAIL_TEST(b.data() >= a.data() + 10 ||
+                           a.data() >= b.data() + 10);
+  }
+
+  auto const stats_steady = arena.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats_steady.num_allocations ==
+                         stats_grown.num_allocations);
+  HPX_KOKKOS_DETAIL_TEST(stats_steady.num_leases ==
+                         stats_before.num_leases + 4);
+}
+
+// A lease that stays alive must not prevent the memory of other leases from
+// being reused.
+void test_long_lived_lease() {
+  auto &arena = hpx::kokkos::get_scratch_arena<Kokkos::HostSpace>(
+      Kokkos::DefaultHostExecutionSpace());
+
+  auto long_lived = arena.acquire();
+  auto a = long_lived.allocate<double>(10);
+  a(0) = 1.0;
+
+  // Warm up the buffer and check that overflow blocks are deallocated when
+  // the lease that allocated them is released.
+  {
+    auto lease = arena.acquire();
+    lease.allocate<double>(100);
+    lease.allocate<char>(arena.statistics().capacity + 1);
+    HPX_KOKKOS_DETAIL_TEST(arena.statistics().overflow_bytes > 0);
+  }
+  HPX_KOKKOS_DETAIL_TEST(arena.statistics().overflow_bytes == 0);
+
+  {
+    auto lease = arena.acquire();
+    lease.allocate<double>(100);
+  }
+
+  auto const stats_before = arena.statistics();
+  for (int i = 0; i < 1000; ++i) {
+    auto lease = arena.acquire();
+    auto b = lease.allocate<double>(100);
+    HPX_KOKKOS_DETAIL_TEST(b.data() >= a.data() + 10 ||
+                           a.data() >= b.data() + 100);
+  }
+
+  auto const stats_after = arena.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats_after.num_allocations ==
+                         stats_before.num_allocations);
+  HPX_KOKKOS_DETAIL_TEST(stats_after.capacity == stats_before.capacity);
+  HPX_KOKKOS_DETAIL_TEST(stats_after.overflow_bytes == 0);
+  HPX_KOKKOS_DETAIL_TEST(a(0) == 1.0);
+}
+
+template <typename Executor> void test_reduce(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+  using memory_space =
+      hpx::kokkos::detail::reduce_result_space_t<execution_space>;
+
+  int const n = 43;
+  Kokkos::View<int *, execution_space> data("data", n);
+  Kokkos::parallel_for(
+      "scratch_arena init",
+      Kokkos::RangePolicy<execution_space>(exec.instance(), 0, n),
+      KOKKOS_LAMBDA(int i) { data(i) = i; });
+
+  auto reduce = [&] {
+    return hpx::reduce(hpx::kokkos::kok.on(exec).label("scratch_arena reduce"),
+                       data.data(), data.data() + n, 0,
+                       KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  };
+
+  // Warm up the arena.
+  HPX_KOKKOS_DETAIL_TEST(reduce() == (n * (n - 1)) / 2);
+  HPX_KOKKOS_DETAIL_TEST(reduce() == (n * (n - 1)) / 2);
+
+  auto &arena =
+      hpx::kokkos::get_scratch_arena<memory_space>(exec.instance());
+  auto const stats_before = arena.statistics();
+
+  for (int i = 0; i < 10; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(reduce() == (n * (n - 1)) / 2);
+  }
+
+  auto const stats_after = arena.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats_after.num_allocations ==
+                         stats_before.num_allocations);
+  HPX_KOKKOS_DETAIL_TEST(stats_after.num_leases ==
+                         stats_before.num_leases + 10);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_lease();
+    test_long_lived_lease();
+    test_reduce(hpx::kokkos::executor<Kokkos::DefaultExecutionSpace>{});
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test_reduce(hpx::kokkos::executor<Kokkos::DefaultHostExecutionSpace>{});
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
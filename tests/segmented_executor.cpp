@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests HPX parallel algorithms split over multiple instances using the
+/// segmented executor.
+
+#include "test.hpp"
+
+#include <hpx/algorithm.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+#include <hpx/numeric.hpp>
+
+template <typename ExecutionSpace>
+void test_segmented(hpx::kokkos::segmented_executor<ExecutionSpace> exec,
+                    int const n) {
+  Kokkos::View<int *, ExecutionSpace> data("data", n);
+  auto data_host = Kokkos::create_mirror_view(data);
+  for (std::size_t i = 0; i < n; ++i) {
+    data_host(i) = i;
+  }
+  Kokkos::deep_copy(data, data_host);
+
+  hpx::for_each(
+      hpx::kokkos::kok.on(exec).label("segmented for_each sync"), data.data(),
+      data.data() + data.size(), KOKKOS_LAMBDA(int &x) { x *= 2; });
+  Kokkos::deep_copy(data_host, data);
+  for (std::size_t i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(data_host(i) == 2 * i);
+  }
+
+  auto f = hpx::experimental::for_loop(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("segmented for_loop task"),
+      0, n, KOKKOS_LAMBDA(int i) { data(i) += 1; });
+  f.get();
+  Kokkos::deep_copy(data_host, data);
+  for (std::size_t i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(data_host(i) == 2 * i + 1);
+  }
+
+  int const offset = -3;
+  auto f_result = hpx::reduce(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("segmented reduce task"),
+      data.data(), data.data() + data.size(), offset,
+      KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(f_result.get() == offset + n * n);
+
+  int result_max = hpx::reduce(
+      hpx::kokkos::kok.on(exec).label("segmented reduce sync"), data.data(),
+      data.data() + data.size(), -100,
+      KOKKOS_LAMBDA(int x, int y) { return x > y ? x : y; });
+  HPX_KOKKOS_DETAIL_TEST(result_max == (n > 0 ? 2 * n - 1 : -100));
+
+  // Ranges that are not views are split over the instances like iterators.
+  int result_range = hpx::ranges::reduce(
+      hpx::kokkos::kok.on(exec).label("segmented reduce range sync"),
+      hpx::util::make_iterator_range(data.data(), data.data() + data.size()),
+      offset, KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(result_range == offset + n * n);
+}
+
+template <typename ExecutionSpace> void test() {
+  // Algorithms that do not split their range (e.g. over views, Kokkos
+  // execution policies, or with reducers) only accept single instances.
+  static_assert(
+      hpx::kokkos::detail::is_single_instance<ExecutionSpace>::value,
+      "execution spaces are single instances");
+  static_assert(!hpx::kokkos::detail::is_single_instance<
+                    hpx::kokkos::instance_set<ExecutionSpace>>::value,
+                "instance sets are not single instances");
+
+  hpx::kokkos::kokkos_instance_helper<ExecutionSpace> h(4);
+
+  auto exec = h.get_segmented_executor(3);
+  HPX_KOKKOS_DETAIL_TEST(exec.instance().size() == 3);
+
+  // Fewer, equal to, and more elements than instances
+  test_segmented(exec, 2);
+  test_segmented(exec, 3);
+  test_segmented(exec, 43);
+
+  exec.get_future().get();
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test<Kokkos::DefaultExecutionSpace>();
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test<Kokkos::DefaultHostExecutionSpace>();
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
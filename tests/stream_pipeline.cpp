@@ -0,0 +1,243 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests streaming batches through a stream_pipeline.
+
+#include "test.hpp"
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+template <typename ExecutionSpace> void test_stream_pipeline() {
+  using host_view_type = Kokkos::View<int *, Kokkos::HostSpace>;
+
+  int const batch_size = 100;
+  int const num_batches = 20;
+
+  hpx::kokkos::stream_pipeline<int, double, ExecutionSpace> pipeline(batch_size,
+                                                                     3);
+  HPX_KOKKOS_DETAIL_TEST(pipeline.batch_size() == batch_size);
+  HPX_KOKKOS_DETAIL_TEST(pipeline.num_buffers() == 3);
+  HPX_KOKKOS_DETAIL_TEST(pipeline.can_submit());
+
+  std::vector<host_view_type> inputs;
+  std::vector<Kokkos::View<double *, Kokkos::HostSpace>> outputs;
+  std::vector<hpx::shared_future<void>> futures;
+  for (int b = 0; b < num_batches; ++b) {
+    // The last batch is smaller than the buffers.
+    int const n = b == num_batches - 1 ? batch_size / 2 : batch_size;
+    inputs.emplace_back("input", n);
+    outputs.emplace_back("output", n);
+    for (int i = 0; i < n; ++i) {
+      inputs.back()(i) = b * batch_size + i;
+    }
+
+    futures.push_back(pipeline.submit(
+        inputs.back(), outputs.back(),
+        [](ExecutionSpace const &instance, auto const &in, auto const &out) {
+          Kokkos::parallel_for(
+              "stream_pipeline compute",
+              Kokkos::RangePolicy<ExecutionSpace>(instance, 0, in.extent(0)),
+              KOKKOS_LAMBDA(int i) { out(i) = 0.5 * in(i); });
+        }));
+  }
+
+  pipeline.done().get();
+  HPX_KOKKOS_DETAIL_TEST(pipeline.can_submit());
+
+  for (int b = 0; b < num_batches; ++b) {
+    HPX_KOKKOS_DETAIL_TEST(futures[b].is_ready());
+    for (std::size_t i = 0; i < outputs[b].extent(0); ++i) {
+      HPX_KOKKOS_DETAIL_TEST(outputs[b](i) == 0.5 * (b * batch_size + i));
+    }
+  }
+
+  auto const stats = pipeline.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats.num_batches == num_batches);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_backpressure_waits <= num_batches);
+  HPX_KOKKOS_DETAIL_TEST(stats.elapsed_time > 0.0);
+  for (double const u :
+       {stats.upload_utilization(), stats.compute_utilization(),
+        stats.download_utilization()}) {
+    HPX_KOKKOS_DETAIL_TEST(u >= 0.0 && u <= 1.0);
+  }
+
+  // Batches larger than the buffers are rejected.
+  bool caught = false;
+  try {
+    pipeline.submit(host_view_type("too_large", batch_size + 1),
+                    Kokkos::View<double *, Kokkos::HostSpace>("output", 1),
+                    [](ExecutionSpace const &, auto const &, auto const &) {});
+  } catch (std::invalid_argument const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+}
+
+// Returns a compute function for stream_pipeline::submit that halves the
+// input once gate is ready.
+template <typename ExecutionSpace>
+auto make_gated_compute(hpx::shared_future<void> gate) {
+  return [gate](ExecutionSpace const &instance, auto const &in,
+                auto const &out) {
+    gate.wait();
+    Kokkos::parallel_for(
+        "stream_pipeline gated compute",
+        Kokkos::RangePolicy<ExecutionSpace>(instance, 0, in.extent(0)),
+        KOKKOS_LAMBDA(int i) { out(i) = 0.5 * in(i); });
+  };
+}
+
+template <typename Predicate> bool wait_until(Predicate &&p) {
+  hpx::chrono::high_resolution_timer timer;
+  while (!p() && timer.elapsed() < 10.0) {
+    hpx::this_thread::yield();
+  }
+  return p();
+}
+
+template <typename ExecutionSpace> void test_stream_pipeline_backpressure() {
+  using host_view_type = Kokkos::View<int *, Kokkos::HostSpace>;
+  using host_output_type = Kokkos::View<double *, Kokkos::HostSpace>;
+
+  int const n = 100;
+
+  hpx::kokkos::stream_pipeline<int, double, ExecutionSpace> pipeline(n, 1);
+  host_view_type input0("input0", n);
+  host_view_type input1("input1", n);
+  host_output_type output0("output0", n);
+  host_output_type output1("output1", n);
+  for (int i = 0; i < n; ++i) {
+    input0(i) = i;
+    input1(i) = n + i;
+  }
+
+  hpx::promise<void> gate;
+  auto f0 = pipeline.submit(
+      input0, output0, make_gated_compute<ExecutionSpace>(gate.get_future()));
+
+  // The only buffer is in use until the first batch has completed, so the
+  // second submission has to wait.
+  HPX_KOKKOS_DETAIL_TEST(!pipeline.can_submit());
+  hpx::shared_future<void> f1;
+  hpx::shared_future<void> const open = hpx::make_ready_future();
+  auto submitted = hpx::async([&] {
+    f1 = pipeline.submit(input1, output1,
+                         make_gated_compute<ExecutionSpace>(open));
+  });
+  HPX_KOKKOS_DETAIL_TEST(wait_until([&] {
+    return pipeline.statistics().num_backpressure_waits == 1;
+  }));
+  HPX_KOKKOS_DETAIL_TEST(!submitted.is_ready());
+  HPX_KOKKOS_DETAIL_TEST(!f0.is_ready());
+
+  gate.set_value();
+  submitted.get();
+  HPX_KOKKOS_DETAIL_TEST(f0.is_ready());
+  f1.get();
+
+  for (int i = 0; i < n; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(output0(i) == 0.5 * i);
+    HPX_KOKKOS_DETAIL_TEST(output1(i) == 0.5 * (n + i));
+  }
+
+  auto const stats = pipeline.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats.num_batches == 2);
+  HPX_KOKKOS_DETAIL_TEST(stats.num_backpressure_waits == 1);
+}
+
+template <typename ExecutionSpace> void test_stream_pipeline_overlap() {
+  using host_view_type = Kokkos::View<int *, Kokkos::HostSpace>;
+  using host_output_type = Kokkos::View<double *, Kokkos::HostSpace>;
+
+  int const n = 100;
+  int const num_batches = 3;
+
+  hpx::kokkos::stream_pipeline<int, double, ExecutionSpace> pipeline(
+      n, num_batches);
+  std::vector<host_view_type> inputs;
+  std::vector<host_output_type> outputs;
+  std::vector<hpx::shared_future<void>> futures;
+
+  // The computation of batch 1 is held back by gate.
+  hpx::promise<void> gate;
+  hpx::shared_future<void> const gate_future = gate.get_future();
+  hpx::shared_future<void> const open = hpx::make_ready_future();
+  for (int b = 0; b < num_batches; ++b) {
+    inputs.emplace_back("input", n);
+    outputs.emplace_back("output", n);
+    for (int i = 0; i < n; ++i) {
+      inputs.back()(i) = b * n + i;
+    }
+
+    futures.push_back(pipeline.submit(
+        inputs.back(), outputs.back(),
+        make_gated_compute<ExecutionSpace>(b == 1 ? gate_future : open)));
+  }
+
+  // While batch 1 is being computed, batch 0 is downloaded and batch 2 is
+  // uploaded.
+  HPX_KOKKOS_DETAIL_TEST(wait_until([&] {
+    auto const stats = pipeline.statistics();
+    return stats.num_batches == 1 &&
+           stats.num_uploaded_batches == std::size_t(num_batches);
+  }));
+  HPX_KOKKOS_DETAIL_TEST(pipeline.statistics().num_computed_batches == 1);
+  futures[0].get();
+  HPX_KOKKOS_DETAIL_TEST(!futures[1].is_ready());
+  HPX_KOKKOS_DETAIL_TEST(!futures[2].is_ready());
+
+  gate.set_value();
+  pipeline.done().get();
+
+  for (int b = 0; b < num_batches; ++b) {
+    for (int i = 0; i < n; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(outputs[b](i) == 0.5 * (b * n + i));
+    }
+  }
+
+  auto const stats = pipeline.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats.num_batches == std::size_t(num_batches));
+  HPX_KOKKOS_DETAIL_TEST(stats.num_computed_batches ==
+                         std::size_t(num_batches));
+  HPX_KOKKOS_DETAIL_TEST(stats.num_backpressure_waits == 0);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_stream_pipeline<Kokkos::DefaultHostExecutionSpace>();
+    test_stream_pipeline_backpressure<Kokkos::DefaultHostExecutionSpace>();
+    test_stream_pipeline_overlap<Kokkos::DefaultHostExecutionSpace>();
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test_stream_pipeline<Kokkos::DefaultExecutionSpace>();
+      test_stream_pipeline_backpressure<Kokkos::DefaultExecutionSpace>();
+      test_stream_pipeline_overlap<Kokkos::DefaultExecutionSpace>();
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -0,0 +1,108 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests tracing kernels and copies and exporting the trace.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+bool contains(std::string const &s, std::string const &substring) {
+  return s.find(substring) != std::string::npos;
+}
+
+template <typename ExecutionSpace> void test_trace() {
+  using view_type = Kokkos::View<int *, typename ExecutionSpace::memory_space>;
+
+  hpx::kokkos::disable_tracing();
+  hpx::kokkos::clear_trace();
+
+  view_type a("a", 1000);
+  view_type b("b", 1000);
+
+  // Nothing is recorded before tracing is enabled.
+  hpx::kokkos::parallel_for_async(
+      "untraced_kernel",
+      Kokkos::RangePolicy<ExecutionSpace>(ExecutionSpace(), 0, 1000),
+      KOKKOS_LAMBDA(int i) { a(i) = i; })
+      .get();
+
+  hpx::kokkos::enable_tracing(128);
+  HPX_KOKKOS_DETAIL_TEST(hpx::kokkos::tracing_enabled());
+
+  bool caught = false;
+  try {
+    hpx::kokkos::clear_trace();
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+
+  auto f1 = hpx::kokkos::parallel_for_async(
+      "traced_kernel_a",
+      Kokkos::RangePolicy<ExecutionSpace>(ExecutionSpace(), 0, 1000),
+      KOKKOS_LAMBDA(int i) { a(i) = i; });
+  auto f2 = hpx::kokkos::parallel_for_async(
+      "traced_kernel_\"b\"",
+      Kokkos::RangePolicy<ExecutionSpace>(ExecutionSpace(), 0, 1000),
+      KOKKOS_LAMBDA(int i) { b(i) = 2 * i; });
+  f1.get();
+  f2.get();
+  hpx::kokkos::deep_copy_async(ExecutionSpace(), b, a).get();
+
+  hpx::kokkos::disable_tracing();
+  HPX_KOKKOS_DETAIL_TEST(!hpx::kokkos::tracing_enabled());
+
+  std::ostringstream os;
+  hpx::kokkos::write_trace_json(os);
+  std::string const trace = os.str();
+
+  HPX_KOKKOS_DETAIL_TEST(contains(trace, "\"traceEvents\""));
+  HPX_KOKKOS_DETAIL_TEST(!contains(trace, "untraced_kernel"));
+  HPX_KOKKOS_DETAIL_TEST(contains(trace, "\"name\":\"traced_kernel_a\""));
+  // Labels are escaped.
+  HPX_KOKKOS_DETAIL_TEST(
+      contains(trace, "\"name\":\"traced_kernel_\\\"b\\\"\""));
+  HPX_KOKKOS_DETAIL_TEST(contains(trace, "\"cat\":\"launch\""));
+  HPX_KOKKOS_DETAIL_TEST(contains(trace, "\"cat\":\"kernel\""));
+  HPX_KOKKOS_DETAIL_TEST(contains(trace, "\"cat\":\"deep_copy\""));
+  HPX_KOKKOS_DETAIL_TEST(contains(trace, "\"name\":\"process_name\""));
+
+  hpx::kokkos::clear_trace();
+  std::ostringstream cleared;
+  hpx::kokkos::write_trace_json(cleared);
+  HPX_KOKKOS_DETAIL_TEST(!contains(cleared.str(), "traced_kernel_a"));
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_trace<Kokkos::DefaultHostExecutionSpace>();
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test_trace<Kokkos::DefaultExecutionSpace>();
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
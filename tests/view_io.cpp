@@ -0,0 +1,200 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests loading views from binary files and checkpointing views.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+template <typename ExecutionSpace> void test_load_view() {
+  std::string const path = "hpx_kokkos_test_load_view.bin";
+  int const n = 10007;
+
+  std::vector<double> data(n);
+  for (int i = 0; i < n; ++i) {
+    data[i] = 0.5 * i;
+  }
+  {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<char const *>(data.data()),
+               n * sizeof(double));
+  }
+
+  ExecutionSpace inst;
+  Kokkos::View<double *, ExecutionSpace> v("v", n);
+
+  // Chunks that do not divide the file evenly.
+  for (std::size_t chunk_bytes : {std::size_t(1000), std::size_t(1) << 20}) {
+    Kokkos::deep_copy(v, 0.0);
+    hpx::kokkos::load_view_async(path, v, inst, chunk_bytes).get();
+    auto const v_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+    for (int i = 0; i < n; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(v_host(i) == 0.5 * i);
+    }
+  }
+
+  // Views of rank 2 are loaded in the order of their span.
+  Kokkos::View<double **, Kokkos::LayoutRight, Kokkos::HostSpace> m(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "m"), 7, 1000);
+  hpx::kokkos::load_view_async(path, m).get();
+  HPX_KOKKOS_DETAIL_TEST(m(3, 10) == 0.5 * 3010);
+
+  bool caught = false;
+  try {
+    Kokkos::View<double *, ExecutionSpace> too_large("too_large", n + 1);
+    hpx::kokkos::load_view_async(path, too_large, inst);
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+
+  caught = false;
+  try {
+    hpx::kokkos::load_view_async("hpx_kokkos_test_does_not_exist.bin", v,
+                                 inst);
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+
+  std::remove(path.c_str());
+}
+
+template <typename ExecutionSpace> void test_checkpoint() {
+  using vector_type = Kokkos::View<double *, ExecutionSpace>;
+  using matrix_type = Kokkos::View<int **, Kokkos::LayoutRight, ExecutionSpace>;
+
+  std::string const path = "hpx_kokkos_test_checkpoint.bin";
+  int const n = 10007;
+  int const rows = 13;
+  int const cols = 17;
+
+  ExecutionSpace inst;
+  vector_type a("a", n);
+  matrix_type b("b", rows, cols);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(inst, 0, n),
+      KOKKOS_LAMBDA(int i) { a(i) = 0.25 * i; });
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(inst, 0, rows),
+      KOKKOS_LAMBDA(int i) {
+        for (int j = 0; j < cols; ++j) {
+          b(i, j) = i * cols + j;
+        }
+      });
+
+  for (int repetition = 0; repetition < 2; ++repetition) {
+    auto const stats_before =
+        hpx::kokkos::view_pool<Kokkos::HostSpace>::get().statistics();
+    auto f = hpx::kokkos::checkpoint_async(inst, path, a, b);
+
+    // Work enqueued on the instance after the checkpoint does not change the
+    // checkpoint.
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace>(inst, 0, n),
+        KOKKOS_LAMBDA(int i) { a(i) = -1.0; });
+    f.get();
+
+    // The temporary file has been renamed to path.
+    HPX_KOKKOS_DETAIL_TEST(!std::ifstream(path + ".tmp"));
+    HPX_KOKKOS_DETAIL_TEST(bool(std::ifstream(path)));
+
+    // Staging buffers are reused by later checkpoints.
+    auto const stats_after =
+        hpx::kokkos::view_pool<Kokkos::HostSpace>::get().statistics();
+    if (repetition > 0) {
+      HPX_KOKKOS_DETAIL_TEST(stats_after.num_allocations ==
+                             stats_before.num_allocations);
+    }
+
+    vector_type a_restored("a_restored", n);
+    matrix_type b_restored("b_restored", rows, cols);
+    hpx::kokkos::restore_async(inst, path, a_restored, b_restored).get();
+    auto const a_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a_restored);
+    auto const b_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b_restored);
+    for (int i = 0; i < n; ++i) {
+      HPX_KOKKOS_DETAIL_TEST(a_host(i) == 0.25 * i);
+    }
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        HPX_KOKKOS_DETAIL_TEST(b_host(i, j) == i * cols + j);
+      }
+    }
+
+    Kokkos::deep_copy(inst, a, a_restored);
+  }
+
+  // Views that do not match the checkpoint are rejected.
+  bool caught = false;
+  try {
+    matrix_type wrong("wrong", cols, rows);
+    hpx::kokkos::restore_async(inst, path, a, wrong);
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+
+  caught = false;
+  try {
+    hpx::kokkos::restore_async(inst, path, a);
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << "not a checkpoint file";
+  }
+  caught = false;
+  try {
+    hpx::kokkos::restore_async(inst, path, a, b);
+  } catch (std::runtime_error const &) {
+    caught = true;
+  }
+  HPX_KOKKOS_DETAIL_TEST(caught);
+
+  std::remove(path.c_str());
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_load_view<Kokkos::DefaultHostExecutionSpace>();
+    test_checkpoint<Kokkos::DefaultHostExecutionSpace>();
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test_load_view<Kokkos::DefaultExecutionSpace>();
+      test_checkpoint<Kokkos::DefaultExecutionSpace>();
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}
@@ -4,7 +4,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 /// \file
-/// Tests using an iterator based on a Kokkos view.
+/// Tests using an iterator based on a Kokkos view, and views of containers.
 
 #include "test.hpp"
 
@@ -12,6 +12,13 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/kokkos.hpp>
 #include <hpx/kokkos/detail/polling_helper.hpp>
+#include <hpx/numeric.hpp>
+
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+struct incomplete;
 
 template <typename Executor> void test_for_each(Executor &&exec) {
   int const n = 43;
@@ -60,7 +67,154 @@ template <typename Executor> void test_for_each(Executor &&exec) {
   }
 }
 
-template <typename Executor> void test(Executor &&exec) { test_for_each(exec); }
+template <typename Executor> void test_strided(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+  int const n = 43;
+  int const m = 5;
+
+  Kokkos::View<int **, Kokkos::LayoutRight, execution_space> strided_data(
+      "strided_data", n, m);
+  auto strided_data_host = Kokkos::create_mirror_view(strided_data);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      strided_data_host(i, j) = i * m + j;
+    }
+  }
+  Kokkos::deep_copy(strided_data, strided_data_host);
+
+  // A column of a LayoutRight view has a stride of m
+  auto column = Kokkos::subview(strided_data, Kokkos::ALL, 1);
+  hpx::for_each(hpx::kokkos::kok.on(exec).label("for_each strided"),
+                hpx::kokkos::view_begin(column),
+                hpx::kokkos::view_end(column),
+                KOKKOS_LAMBDA(int &x) { x = -x; });
+  Kokkos::deep_copy(strided_data_host, strided_data);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      int const expected = i * m + j;
+      HPX_KOKKOS_DETAIL_TEST(strided_data_host(i, j) ==
+                             (j == 1 ? -expected : expected));
+    }
+  }
+
+  int const column_sum = hpx::ranges::reduce(
+      hpx::kokkos::kok.on(exec).label("reduce strided view range"),
+      hpx::kokkos::make_view_range(column), 0,
+      KOKKOS_LAMBDA(int x, int y) { return x + y; });
+  HPX_KOKKOS_DETAIL_TEST(column_sum == -(m * (n * (n - 1)) / 2 + n));
+}
+
+template <typename Executor> void test_view_range(Executor &&exec) {
+  using execution_space = typename std::decay<Executor>::type::execution_space;
+  int const n = 43;
+  int const m = 5;
+  int const k = 3;
+
+  Kokkos::View<int ***, execution_space> view_range_data("view_range_data", n,
+                                                         m, k);
+  auto view_range_data_host = Kokkos::create_mirror_view(view_range_data);
+
+  // Rank 3 views are launched with a multi-dimensional range policy
+  hpx::ranges::for_each(
+      hpx::kokkos::kok(hpx::execution::task)
+          .on(exec)
+          .label("for_each view range"),
+      hpx::kokkos::make_view_range(view_range_data),
+      KOKKOS_LAMBDA(int &x) { x += 2; })
+      .get();
+  hpx::ranges::for_each(hpx::kokkos::kok.on(exec).label("for_each view"),
+                        view_range_data, KOKKOS_LAMBDA(int &x) { x *= 3; });
+  Kokkos::deep_copy(view_range_data_host, view_range_data);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      for (std::size_t l = 0; l < k; ++l) {
+        HPX_KOKKOS_DETAIL_TEST(view_range_data_host(i, j, l) == 6);
+      }
+    }
+  }
+}
+
+void test_iteration_order() {
+  int const n = 7;
+  int const m = 5;
+
+  Kokkos::View<int **, Kokkos::LayoutLeft, Kokkos::HostSpace> left("left", n,
+                                                                    m);
+  Kokkos::View<int **, Kokkos::LayoutRight, Kokkos::HostSpace> right("right", n,
+                                                                     m);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      left(i, j) = i + j * n;
+      right(i, j) = i * m + j;
+    }
+  }
+
+  // Iterators traverse views in memory order
+  auto left_begin = hpx::kokkos::view_begin(left);
+  auto right_begin = hpx::kokkos::view_begin(right);
+  HPX_KOKKOS_DETAIL_TEST(hpx::kokkos::view_end(left) - left_begin == n * m);
+  HPX_KOKKOS_DETAIL_TEST(hpx::kokkos::view_end(right) - right_begin == n * m);
+  for (int i = 0; i < n * m; ++i) {
+    HPX_KOKKOS_DETAIL_TEST(left_begin[i] == i);
+    HPX_KOKKOS_DETAIL_TEST(*(right_begin + i) == i);
+  }
+}
+
+void test_as_view() {
+  int const n = 43;
+
+  static_assert(hpx::kokkos::is_contiguous_iterator<int *>::value, "");
+  static_assert(
+      hpx::kokkos::is_contiguous_iterator<std::vector<int>::iterator>::value,
+      "");
+  static_assert(
+      !hpx::kokkos::is_contiguous_iterator<std::vector<bool>::iterator>::value,
+      "");
+  static_assert(!hpx::kokkos::is_contiguous_iterator<int>::value, "");
+  // Output iterators have void as value_type.
+  static_assert(!hpx::kokkos::is_contiguous_iterator<
+                    std::back_insert_iterator<std::vector<int>>>::value,
+                "");
+  static_assert(
+      !hpx::kokkos::is_contiguous_iterator<std::ostream_iterator<int>>::value,
+      "");
+  static_assert(hpx::kokkos::is_contiguous_iterator<incomplete *>::value, "");
+
+  std::vector<int> v(n);
+  auto a = hpx::kokkos::as_view(v);
+  static_assert(std::is_same<decltype(a),
+                             hpx::kokkos::unmanaged_view_t<int>>::value,
+                "");
+  HPX_KOKKOS_DETAIL_TEST(a.extent(0) == n && a.data() == v.data());
+  for (int i = 0; i < n; ++i) {
+    a(i) = i;
+  }
+  HPX_KOKKOS_DETAIL_TEST(v[n - 1] == n - 1);
+
+  auto b = hpx::kokkos::as_view(v.cbegin() + 1, v.cend());
+  static_assert(std::is_same<decltype(b),
+                             hpx::kokkos::unmanaged_view_t<int const>>::value,
+                "");
+  HPX_KOKKOS_DETAIL_TEST(b.extent(0) == n - 1 && b(0) == 1);
+  HPX_KOKKOS_DETAIL_TEST(hpx::kokkos::as_view(v.end(), v.end()).size() == 0);
+
+  // Algorithms use the adapters for contiguous iterators.
+  hpx::kokkos::default_host_executor exec;
+  hpx::for_each(hpx::kokkos::kok.on(exec), v.begin(), v.end(),
+                KOKKOS_LAMBDA(int &x) { x *= 2; });
+  HPX_KOKKOS_DETAIL_TEST(v[n - 1] == 2 * (n - 1));
+  HPX_KOKKOS_DETAIL_TEST(hpx::reduce(hpx::kokkos::kok.on(exec), v.cbegin(),
+                                     v.cend(), 0,
+                                     KOKKOS_LAMBDA(int x, int y) {
+                                       return x + y;
+                                     }) == n * (n - 1));
+}
+
+template <typename Executor> void test(Executor &&exec) {
+  test_for_each(exec);
+  test_strided(exec);
+  test_view_range(exec);
+}
 
 int test_main(int argc, char *argv[]) {
   Kokkos::initialize(argc, argv);
@@ -69,6 +223,8 @@ int test_main(int argc, char *argv[]) {
     hpx::kokkos::detail::polling_helper p;
     (void)p;
 
+    test_iteration_order();
+    test_as_view();
     test(hpx::kokkos::default_executor{});
     if (!std::is_same<hpx::kokkos::default_executor,
                       hpx::kokkos::default_host_executor>::value) {
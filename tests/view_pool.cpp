@@ -0,0 +1,115 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// Tests asynchronous view allocation from a view pool.
+
+#include "test.hpp"
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/kokkos.hpp>
+#include <hpx/kokkos/detail/polling_helper.hpp>
+
+template <typename Pool> void wait_for_pending_blocks(Pool &pool) {
+  while (pool.statistics().num_pending_blocks > 0) {
+    hpx::this_thread::yield();
+  }
+}
+
+template <typename ExecutionSpace> void test_view_pool() {
+  using memory_space = typename ExecutionSpace::memory_space;
+  auto &pool = hpx::kokkos::view_pool<memory_space>::get();
+  ExecutionSpace instance;
+
+  int const n = 43;
+  int const m = 17;
+
+  auto const stats_before = pool.statistics();
+
+  {
+    auto pv =
+        hpx::kokkos::make_view_async<int *>(instance, "pooled_a", n).get();
+    auto a = pv.view();
+    HPX_KOKKOS_DETAIL_TEST(a.extent(0) == n);
+
+    int sum = 0;
+    Kokkos::parallel_reduce(
+        "pooled_a init", Kokkos::RangePolicy<ExecutionSpace>(instance, 0, n),
+        KOKKOS_LAMBDA(int i, int &update) {
+          update += a(i);
+          a(i) = i;
+        },
+        sum);
+    HPX_KOKKOS_DETAIL_TEST(sum == 0);
+  }
+
+  wait_for_pending_blocks(pool);
+  auto const stats_first = pool.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats_first.num_allocations ==
+                         stats_before.num_allocations + 1);
+
+  // A view of a different type that fits in the same block size reuses the
+  // released block and is initialized again.
+  {
+    auto pv = hpx::kokkos::make_view_async<int **>(instance, "pooled_b", n / 2,
+                                                   2)
+                  .get();
+    auto b = pv.view();
+    HPX_KOKKOS_DETAIL_TEST(b.extent(0) == n / 2 && b.extent(1) == 2);
+
+    int sum = 0;
+    Kokkos::parallel_reduce(
+        "pooled_b check",
+        Kokkos::RangePolicy<ExecutionSpace>(instance, 0, n / 2),
+        KOKKOS_LAMBDA(int i, int &update) { update += b(i, 0) + b(i, 1); },
+        sum);
+    HPX_KOKKOS_DETAIL_TEST(sum == 0);
+  }
+
+  auto const stats_second = pool.statistics();
+  HPX_KOKKOS_DETAIL_TEST(stats_second.num_allocations ==
+                         stats_first.num_allocations);
+  HPX_KOKKOS_DETAIL_TEST(stats_second.num_reuses ==
+                         stats_first.num_reuses + 1);
+
+  // Views that are alive at the same time use different blocks.
+  {
+    auto f1 = hpx::kokkos::make_view_async<double **>(instance, "pooled_c", n,
+                                                      m);
+    auto f2 = hpx::kokkos::make_view_async<double **>(instance, "pooled_d", n,
+                                                      m);
+    HPX_KOKKOS_DETAIL_TEST(f1.get().view().data() != f2.get().view().data());
+  }
+
+  wait_for_pending_blocks(pool);
+  pool.release_unused();
+  HPX_KOKKOS_DETAIL_TEST(pool.statistics().allocated_bytes ==
+                         stats_before.allocated_bytes);
+}
+
+int test_main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  {
+    hpx::kokkos::detail::polling_helper p;
+    (void)p;
+
+    test_view_pool<Kokkos::DefaultExecutionSpace>();
+    if (!std::is_same<Kokkos::DefaultExecutionSpace,
+                      Kokkos::DefaultHostExecutionSpace>::value) {
+      test_view_pool<Kokkos::DefaultHostExecutionSpace>();
+    }
+  }
+
+  Kokkos::finalize();
+  hpx::finalize();
+
+  return hpx::kokkos::detail::report_errors();
+}
+
+int main(int argc, char *argv[]) {
+  return hpx::init(test_main, argc, argv);
+}